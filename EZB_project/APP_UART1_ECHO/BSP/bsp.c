@@ -12,6 +12,7 @@
 #include  <bsp_sys.h>
 #include  <bsp_int.h>
 #include  <bsp_uart.h>
+#include  <bsp_tmr.h>
 #include "io_lib.h"
 #include "io_driver.h"
 
@@ -50,6 +51,7 @@ void  BSP_Init (void)
 {
 	BSP_IntInit();
 	BSP_UART_Init();
+	BSP_Tmr_Init();
 }
 /**
  * @brief Configure the IOs where the buttons are connected to input mode.
@@ -31,11 +31,14 @@ static uint8_t  End_of_Packet  = '$';                        /* in ASCII '$' */
 /****************************************************** FILE LOCAL PROTOTYPES */
 static  void  BSP_IntHandler (CPU_DATA  int_id);
 static  void  BSP_IntHandler_Uart_Recive (void);
+static  void  BSP_Uart_RxByte (void  *p_arg);
 
+// Deferred work queue
+extern OS_DEFER_Q   UART_Defer;
 // Message Queues
 extern OS_Q         UART_ISR;
 // Memory Block
-extern OS_MEM       Mem_Partition;
+extern OS_MEM_SLAB  Mem_Slab;
 
 /****************************************************************** FUNCTIONS */
 /**
@@ -134,6 +137,11 @@ void  BSP_IntInit (void)
 {
 	BSP_IntVectSet (USIC1_1_IRQn, BSP_IntHandler_Uart_Recive); //**
 	BSP_IntVectSet (USIC1_0_IRQn, BSP_IntHandler_Uart_Recive); //**
+
+	/* the UART handler posts to the kernel: keep it kernel aware, i.e. at
+	 * or below CPU_CFG_KA_IPL_BOUNDARY (see cpu_cfg.h) */
+	BSP_IntPrioSet (USIC1_1_IRQn, CPU_CFG_KA_BASEPRI);
+	BSP_IntPrioSet (USIC1_0_IRQn, CPU_CFG_KA_BASEPRI);
 }
 
 /**
@@ -141,9 +149,30 @@ void  BSP_IntInit (void)
  * \params   none
  * \returns  none
  * \brief    UART interrupt handler
- *           https://doc.micrium.com/display/osiiidoc/Keeping+the+Data+in+Scope
+ *
+ * \note The handler only reads the byte and defers it to the worker task of
+ *       UART_Defer, which does the framing in BSP_Uart_RxByte(). Bytes lost
+ *       because the queue is full are counted in UART_Defer.OvfCtr.
  */
 static  void  BSP_IntHandler_Uart_Recive (void)
+{
+	OS_ERR             err;
+	CPU_CHAR           RxData;
+
+	// receive byte
+	RxData = XMC_UART_CH_GetReceivedData (XMC_UART1_CH1);                   // <1>
+	OSDeferQPost (&UART_Defer, BSP_Uart_RxByte, (void *) (uintptr_t) RxData, &err);
+	(void) err;
+}
+
+/**
+ * \function BSP_Uart_RxByte()
+ * \params   p_arg ... received byte (see BSP_IntHandler_Uart_Recive())
+ * \returns  none
+ * \brief    frames the received bytes at task level
+ *           https://doc.micrium.com/display/osiiidoc/Keeping+the+Data+in+Scope
+ */
+static  void  BSP_Uart_RxByte (void  *p_arg)
 {
 	OS_ERR             err;
 	CPU_CHAR           RxData;
@@ -151,15 +180,14 @@ static  void  BSP_IntHandler_Uart_Recive (void)
 	static CPU_INT32U  RxDataCtr = 0;
 	static CPU_CHAR    msg_receiving = 0;
 
-	// receive byte
-	RxData = XMC_UART_CH_GetReceivedData (XMC_UART1_CH1);                   // <1>
+	RxData = (CPU_CHAR) (uintptr_t) p_arg;
 
 	// is the character a "start of packet" character?                      // <2>
 	if ( ( (int) RxData == Start_of_Packet) && msg_receiving == 0) {
 		// allocate a memory block
-		RxDataPtr = (CPU_CHAR *) OSMemGet (&Mem_Partition, &err);
+		RxDataPtr = (CPU_CHAR *) OSMemSlabGet (&Mem_Slab, APP_CFG_MSG_SIZE_MAX, &err);
 		if (err != OS_ERR_NONE)
-			APP_TRACE_DBG ("Error OSMemGet: BSP_IntHandler_Uart_Recive\n");
+			APP_TRACE_DBG ("Error OSMemSlabGet: BSP_Uart_RxByte\n");
 		else
 			msg_receiving = 1;
 	}
@@ -170,6 +198,15 @@ static  void  BSP_IntHandler_Uart_Recive (void)
 	//       but no "end of packet character"
 	if ( ( (int) RxData != Start_of_Packet) && ( (int) RxData != End_of_Packet)
 	     && msg_receiving == 1) {
+		// drop frames that do not fit into the block (leave room for the NUL)
+		if (RxDataCtr >= (APP_CFG_MSG_SIZE_MAX - 1u)) {
+			OSMemSlabPut (&Mem_Slab, (void *) (RxDataPtr - RxDataCtr), &err);
+			APP_TRACE_DBG ("Error frame too long: BSP_Uart_RxByte\n");
+			RxDataPtr = NULL;
+			RxDataCtr = 0;
+			msg_receiving = 0;
+			return;
+		}
 		// put byte into the memory partition at the respective address
 		*RxDataPtr = RxData;
 		// increment the address to point to the next location
@@ -188,7 +225,7 @@ static  void  BSP_IntHandler_Uart_Recive (void)
 			  (OS_OPT)      OS_OPT_POST_FIFO,
 			  (OS_ERR    *) &err);
 		if (err != OS_ERR_NONE)
-			APP_TRACE_DBG ("Error OSQPost: BSP_IntHandler_Uart_Recive\n");
+			APP_TRACE_DBG ("Error OSQPost: BSP_Uart_RxByte\n");
 
 		// clear the receive pointer and counter                              // <5>
 		RxDataPtr = NULL;
@@ -0,0 +1,133 @@
+/**
+ * @file bsp_tmr.c
+ * @brief board support for the high-resolution kernel timer (CCU40 slice 0)
+ *
+ * CCU40 slice 0 runs in single shot mode and raises a period match interrupt
+ * when the earliest task waiting in OSTimeDlyUs()/OSTimeDlyCycles() (or on a
+ * pend timeout set with OSTimeTimeoutSetUs()) is due. The kernel arms it via
+ * OS_TickHrTmrSet() and the ISR hands over to OSTimeTickHr().
+ */
+
+/******************************************************************* INCLUDES */
+#include  <cpu.h>
+#include  <os.h>
+#include  <bsp_int.h>
+#include  <bsp_tmr.h>
+#include  <xmc_ccu4.h>
+#include  <xmc_scu.h>
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+/********************************************************* FILE LOCAL DEFINES */
+#define  BSP_TMR_MODULE       CCU40
+#define  BSP_TMR_SLICE        CCU40_CC40
+#define  BSP_TMR_PSC_MAX      15u                 /* fccu / 2^15 */
+#define  BSP_TMR_PERIOD_MAX   0xFFFFu
+
+/********************************************************* FILE LOCAL GLOBALS */
+static  CPU_INT32U  BSP_TmrCcuFreq;               /* CCU4 clock [Hz] */
+static  CPU_INT32U  BSP_TmrCpuFreq;               /* CPU_TS timer clock [Hz] */
+
+/****************************************************** FILE LOCAL PROTOTYPES */
+static  void  BSP_Tmr_IntHandler (void);
+
+/****************************************************************** FUNCTIONS */
+/**
+ * @function BSP_Tmr_Init()
+ * @params none
+ * @returns none
+ * @brief Set up CCU40 slice 0 as a single shot timer interrupting on period
+ *        match. Must be called after CPU_TS_TmrInit().
+ */
+void  BSP_Tmr_Init (void)
+{
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t  config = {
+		.timer_mode        = XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA,
+		.monoshot          = XMC_CCU4_SLICE_TIMER_REPEAT_MODE_SINGLE,
+		.prescaler_mode    = XMC_CCU4_SLICE_PRESCALER_MODE_NORMAL,
+		.prescaler_initval = 0u
+	};
+	CPU_ERR  err;
+
+	BSP_TmrCcuFreq = XMC_SCU_CLOCK_GetCcuClockFrequency();
+	BSP_TmrCpuFreq = (CPU_INT32U)CPU_TS_TmrFreqGet(&err);
+
+	XMC_CCU4_Init (BSP_TMR_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR);
+	XMC_CCU4_StartPrescaler (BSP_TMR_MODULE);
+	XMC_CCU4_SLICE_CompareInit (BSP_TMR_SLICE, &config);
+	XMC_CCU4_SLICE_EnableEvent (BSP_TMR_SLICE,
+	                            XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH);
+	XMC_CCU4_SLICE_SetInterruptNode (BSP_TMR_SLICE,
+	                                 XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH,
+	                                 XMC_CCU4_SLICE_SR_ID_0);
+	XMC_CCU4_EnableClock (BSP_TMR_MODULE, 0u);
+
+	/* the handler calls into the kernel: keep it kernel aware, i.e. at or
+	 * below CPU_CFG_KA_IPL_BOUNDARY (see cpu_cfg.h) */
+	BSP_IntVectSet (BSP_INT_ID_CCU40_00, BSP_Tmr_IntHandler);
+	BSP_IntPrioSet (BSP_INT_ID_CCU40_00, CPU_CFG_KA_BASEPRI);
+	NVIC_EnableIRQ (CCU40_0_IRQn);
+}
+
+/**
+ * @function OS_TickHrTmrSet()
+ * @params cycles ... time until the next interrupt in CPU_TS timer counts
+ * @returns none
+ * @brief Re-arm the timer, called by the kernel with interrupts disabled.
+ *
+ * The smallest prescaler that fits the 16 bit period is used. Longer times
+ * are cut to the maximum period (about 17.9 s at fccu = 120 MHz); the kernel
+ * then finds nothing due and re-arms the timer for the remaining time.
+ */
+void  OS_TickHrTmrSet (CPU_TS_TMR cycles)
+{
+	CPU_INT64U  cnt;
+	CPU_INT08U  psc;
+
+	XMC_CCU4_SLICE_StopTimer (BSP_TMR_SLICE);
+	XMC_CCU4_SLICE_ClearTimer (BSP_TMR_SLICE);
+
+	cnt = (CPU_INT64U)cycles;
+	if ((BSP_TmrCpuFreq != 0u) && (BSP_TmrCpuFreq != BSP_TmrCcuFreq)) {
+		cnt = (cnt * BSP_TmrCcuFreq + BSP_TmrCpuFreq - 1u) / BSP_TmrCpuFreq;
+	}
+
+	psc = 0u;
+	while ((cnt > BSP_TMR_PERIOD_MAX) && (psc < BSP_TMR_PSC_MAX)) {
+		cnt = (cnt + 1u) >> 1;                    /* round up: never early */
+		psc++;
+	}
+	if (cnt > BSP_TMR_PERIOD_MAX) {
+		cnt = BSP_TMR_PERIOD_MAX;
+	}
+	if (cnt == 0u) {
+		cnt = 1u;
+	}
+
+	XMC_CCU4_SLICE_SetPrescaler (BSP_TMR_SLICE, psc);
+	XMC_CCU4_SLICE_SetTimerPeriodMatch (BSP_TMR_SLICE, (uint16_t)cnt);
+	XMC_CCU4_EnableShadowTransfer (BSP_TMR_MODULE,
+	                               XMC_CCU4_SHADOW_TRANSFER_SLICE_0 |
+	                               XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0);
+	XMC_CCU4_SLICE_StartTimer (BSP_TMR_SLICE);
+}
+
+/**
+ * @function BSP_Tmr_IntHandler()
+ * @params none
+ * @returns none
+ * @brief Period match of CCU40 slice 0, runs inside BSP_IntHandler() i.e.
+ *        between OSIntEnter() and OSIntExit().
+ */
+static  void  BSP_Tmr_IntHandler (void)
+{
+	XMC_CCU4_SLICE_ClearEvent (BSP_TMR_SLICE,
+	                           XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH);
+	OSTimeTickHr();
+}
+
+#else
+void  BSP_Tmr_Init (void)
+{
+}
+#endif
+/*! EOF */
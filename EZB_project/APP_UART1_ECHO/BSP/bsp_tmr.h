@@ -0,0 +1,16 @@
+/**
+ * @file bsp_tmr.h
+ * @brief board support for the high-resolution kernel timer (CCU40 slice 0)
+ */
+
+#ifndef  BSP_TMR_PRESENT
+#define  BSP_TMR_PRESENT
+
+/******************************************************************* INCLUDES */
+#include  <cpu.h>
+
+/******************************************************** FUNCTION PROTOTYPES */
+void  BSP_Tmr_Init (void);
+
+#endif
+/*! EOF */
@@ -35,6 +35,7 @@
 #include <GPIO.h>
 
 #include <lib_math.h>
+#include <lib_str.h>
 
 #if SEMI_HOSTING
 #include <debug_lib.h>
@@ -47,10 +48,18 @@
 
 /******************************************************************** DEFINES */
 #define ACK 0x6
-#define MAX_MSG_LENGTH 20
+#define MAX_MSG_LENGTH APP_CFG_MSG_SIZE_MAX
 #define NUM_MSG 3
 #define WAIT_DELAY 5000000
 
+/********************************************************************** TYPES */
+// A frame published on the LED bus: bus header, then the frame itself
+typedef struct
+{
+  OS_BUS_MSG Hdr;
+  CPU_CHAR Frame[MAX_MSG_LENGTH];
+} APP_BUS_MSG;
+
 /********************************************************* FILE LOCAL GLOBALS */
 static CPU_STK AppStartTaskStk[APP_CFG_TASK_START_STK_SIZE]; // <1>
 static OS_TCB AppStartTaskTCB;
@@ -64,20 +73,33 @@ static OS_TCB AppTaskLED_1_TCB;
 static CPU_STK AppTaskLED_2Stk[APP_CFG_TASK_COM_STK_SIZE];
 static OS_TCB AppTaskLED_2_TCB;
 
-// Memory Block                                                           // <2>
-OS_MEM Mem_Partition;
-CPU_CHAR MyPartitionStorage[NUM_MSG - 1][MAX_MSG_LENGTH];
-// Memory Block                                                           // <2>
-OS_MEM Mem_LED1;
-CPU_CHAR Mem_LED1Storage[NUM_MSG - 1][MAX_MSG_LENGTH];
-// Memory Block
-OS_MEM Mem_RES;
-CPU_CHAR Mem_RESStorage[NUM_MSG - 1][MAX_MSG_LENGTH];
-// Message Queue
-OS_Q UART_ISR;
-OS_Q DATA_Msg;
-OS_Q DATA_Msg_led2;
+static CPU_STK AppTaskDeferStk[APP_CFG_TASK_DEFER_STK_SIZE];
+static OS_TCB AppTaskDefer_TCB;
+
+// Size-class allocator shared by the UART ISR and the tasks             // <2>
+// (16, 32, 64, 128, 256, 512, 1024 byte blocks)
+OS_MEM_SLAB Mem_Slab;
+static const OS_MEM_QTY Mem_SlabNbrBlks[OS_MEM_SLAB_NBR_CLASS] = {
+    0u, 3u * NUM_MSG, 0u, 0u, 0u, 0u, 0u};
+static CPU_INT32U Mem_SlabStorage[OS_MEM_SLAB_SIZE(0u, 3u * NUM_MSG, 0u, 0u,
+                                                   0u, 0u, 0u) /
+                                  sizeof(CPU_INT32U)];
+// Per-frame scratch buffers of AppTaskCom, released at the end of each frame
+static MEM_ARENA AppTaskComArena;
+// Deferred work of the UART ISR: the ISR only queues the received bytes
+OS_DEFER_Q UART_Defer;
+static OS_DEFER_ITEM UART_DeferItemTbl[APP_CFG_UART_DEFER_Q_SIZE];
+// Message Queue, defined ready for use (no OSQCreate() at startup)
+OS_Q_DEFINE(UART_ISR, "ISR Queue", NUM_MSG);
+// LED bus: frames are routed by topic to the subscribed LED tasks
+OS_BUS LED_Bus;
+OS_BUS_SUB LED_Sub_led1;
+OS_BUS_SUB LED_Sub_led2;
 uint8_t keyPress;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+// cycle counter at the start of main(), to report the boot time
+static CPU_TS_TMR AppBootTs;
+#endif
 /****************************************************** RES */
 bool res = false;
 
@@ -85,6 +107,7 @@ bool res = false;
 static void AppTaskStart(void *p_arg);
 static void AppTaskCreate(void);
 static void AppObjCreate(void);
+static void AppBusMsgFree(OS_BUS_MSG *p_msg);
 static void AppTaskCom(void *p_arg);
 static void AppTaskLED_1(void *p_arg);
 static void AppTaskLED_2(void *p_arg);
@@ -102,6 +125,11 @@ int main(void)
 
   // Disable all interrupts                                               // <3>
   BSP_IntDisAll();
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+  // start the DWT cycle counter first to time the boot (see AppTaskCom)
+  CPU_TS_TmrInit();
+  AppBootTs = CPU_TS_TmrRd();
+#endif
   // Enable Interrupt UART
   BSP_IntEn(BSP_INT_ID_USIC1_01); //**
   BSP_IntEn(BSP_INT_ID_USIC1_00); //**
@@ -224,55 +252,74 @@ static void AppTaskStart(void *p_arg)
 static void AppObjCreate(void)
 {
   OS_ERR err;
+  LIB_ERR lib_err;
 
   // Create Shared Memory
-  OSMemCreate((OS_MEM *)&Mem_Partition,
-              (CPU_CHAR *)"Mem Partition",
-              (void *)&MyPartitionStorage[0][0],
-              (OS_MEM_QTY)NUM_MSG,
-              (OS_MEM_SIZE)MAX_MSG_LENGTH * sizeof(CPU_CHAR),
-              (OS_ERR *)&err);
+  OSMemSlabCreate((OS_MEM_SLAB *)&Mem_Slab,
+                  (CPU_CHAR *)"Mem Slab",
+                  (void *)&Mem_SlabStorage[0],
+                  (OS_MEM_QTY const *)&Mem_SlabNbrBlks[0],
+                  (OS_ERR *)&err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSMemCreate: AppObjCreate\n");
-  // Create Shared Memory
-  OSMemCreate((OS_MEM *)&Mem_LED1,
-              (CPU_CHAR *)"Mem LED1",
-              (void *)&Mem_LED1Storage[0][0],
-              (OS_MEM_QTY)NUM_MSG,
-              (OS_MEM_SIZE)MAX_MSG_LENGTH * sizeof(CPU_CHAR),
-              (OS_ERR *)&err);
+    APP_TRACE_DBG("Error OSMemSlabCreate: AppObjCreate\n");
+  // Create the scratch arena of AppTaskCom (carved from the uC-LIB heap)
+  Mem_ArenaCreate("TaskCOM Arena",
+                  &AppTaskComArena,
+                  DEF_NULL,
+                  APP_CFG_TASK_COM_ARENA_SIZE,
+                  &lib_err);
+  if (lib_err != LIB_MEM_ERR_NONE)
+    APP_TRACE_DBG("Error Mem_ArenaCreate: AppObjCreate\n");
+  // Create the deferred work queue of the UART ISR and its worker task
+  OSDeferQCreate((OS_DEFER_Q *)&UART_Defer,
+                 (CPU_CHAR *)"UART Defer",
+                 (OS_DEFER_ITEM *)&UART_DeferItemTbl[0],
+                 (OS_OBJ_QTY)APP_CFG_UART_DEFER_Q_SIZE,
+                 (OS_TCB *)&AppTaskDefer_TCB,
+                 (OS_PRIO)APP_CFG_TASK_DEFER_PRIO,
+                 (CPU_STK *)&AppTaskDeferStk[0],
+                 (CPU_STK_SIZE)APP_CFG_TASK_DEFER_STK_SIZE,
+                 (OS_ERR *)&err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSMemCreate: AppObjCreate\n");
-  // Create Shared Memory
-  OSMemCreate((OS_MEM *)&Mem_RES,
-              (CPU_CHAR *)"Mem_RES",
-              (void *)&Mem_RESStorage[0][0],
-              (OS_MEM_QTY)NUM_MSG,
-              (OS_MEM_SIZE)MAX_MSG_LENGTH * sizeof(CPU_CHAR),
+    APP_TRACE_DBG("Error OSDeferQCreate: AppObjCreate\n");
+  // Create the LED bus and subscribe each LED task to its topic
+  OSBusCreate((OS_BUS *)&LED_Bus,
+              (CPU_CHAR *)"LED Bus",
+              (OS_BUS_FREE_PTR)AppBusMsgFree,
               (OS_ERR *)&err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSMemCreate: AppObjCreate\n");
-  // Create Message Queue
-  OSQCreate((OS_Q *)&UART_ISR,
-            (CPU_CHAR *)"ISR Queue",
-            (OS_MSG_QTY)NUM_MSG,
-            (OS_ERR *)&err);
+    APP_TRACE_DBG("Error OSBusCreate: AppObjCreate\n");
+  OSBusSubscribe((OS_BUS *)&LED_Bus,
+                 (OS_BUS_SUB *)&LED_Sub_led1,
+                 (CPU_CHAR *)"DATA Msg",
+                 (OS_FLAGS)APP_CFG_BUS_TOPIC_LED1,
+                 (OS_MSG_QTY)NUM_MSG,
+                 (OS_ERR *)&err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSQCreate: AppObjCreate\n");
-  // Create Message Queue
-  OSQCreate((OS_Q *)&DATA_Msg,
-            (CPU_CHAR *)"DATA Msg",
-            (OS_MSG_QTY)NUM_MSG,
-            (OS_ERR *)&err);
+    APP_TRACE_DBG("Error OSBusSubscribe: AppObjCreate\n");
+  OSBusSubscribe((OS_BUS *)&LED_Bus,
+                 (OS_BUS_SUB *)&LED_Sub_led2,
+                 (CPU_CHAR *)"DATA Msg led2",
+                 (OS_FLAGS)APP_CFG_BUS_TOPIC_LED2,
+                 (OS_MSG_QTY)NUM_MSG,
+                 (OS_ERR *)&err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSQCreate: AppObjCreate\n");
-  // Create Message Queue
-  OSQCreate((OS_Q *)&DATA_Msg_led2,
-            (CPU_CHAR *)"DATA Msg led2",
-            (OS_MSG_QTY)NUM_MSG,
-            (OS_ERR *)&err);
+    APP_TRACE_DBG("Error OSBusSubscribe: AppObjCreate\n");
+}
+
+/**
+ * \function AppBusMsgFree()
+ * \brief Returns a frame to the slab once every LED task released it.
+ * \params p_msg ... frame published on the LED bus
+ * \returns none
+ */
+static void AppBusMsgFree(OS_BUS_MSG *p_msg)
+{
+  OS_ERR err;
+
+  OSMemSlabPut(&Mem_Slab, p_msg, &err);
   if (err != OS_ERR_NONE)
-    APP_TRACE_DBG("Error OSQCreate: AppObjCreate\n");
+    APP_TRACE_DBG("Error OSMemSlabPut: AppBusMsgFree\n");
 }
 
 /*************************************************** Create Application Tasks */
@@ -360,20 +407,30 @@ static void AppTaskCom(void *p_arg)
   OS_ERR err;
   OS_MSG_SIZE msg_size;
   CPU_TS ts;
-  CPU_CHAR msg[MAX_MSG_LENGTH];
-  CPU_CHAR msg_res[MAX_MSG_LENGTH];
+  CPU_CHAR *msg;
+  CPU_CHAR *msg_res;
   CPU_INT08U i = 0;
-  CPU_CHAR debug_msg[MAX_MSG_LENGTH + 30];
-  CPU_CHAR *pbuf = NULL;
+  CPU_CHAR *debug_msg;
+  APP_BUS_MSG *pbuf = NULL;
   CPU_CHAR *get_res = NULL;
+  OS_FLAGS topics;
+  OS_OPT opt;
+  MEM_ARENA_MARK mark;
+  LIB_ERR lib_err;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+  CPU_CHAR boot_msg[40];
+#endif
 
   (void)p_arg; // <14>
   APP_TRACE_INFO("Entering AppTaskCom ...\n");
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+  // boot time: from main() until the UART frames are served
+  Str_Fmt_N(boot_msg, sizeof(boot_msg), "Boot to ready: %lu cycles\n",
+            (unsigned long)(CPU_TS_TmrRd() - AppBootTs));
+  APP_TRACE_INFO(boot_msg);
+#endif
   while (DEF_TRUE)
   {
-    // empty the message buffer
-    memset(&msg, 0, MAX_MSG_LENGTH);
-    memset(&msg_res, 0, MAX_MSG_LENGTH); // <15>
     // wait until a message is received
     p_msg = OSQPend(&UART_ISR, // <16>
                     0,
@@ -384,19 +441,41 @@ static void AppTaskCom(void *p_arg)
     if (err != OS_ERR_NONE)
       APP_TRACE_DBG("Error OSQPend: AppTaskCom\n");
 
-    // obtain message we received
+    // take this frame's scratch buffers from the arena                   // <15>
+    mark = Mem_ArenaMark(&AppTaskComArena);
+    // msg gets one byte more for the terminator after a full frame
+    msg = (CPU_CHAR *)Mem_ArenaAlloc(&AppTaskComArena, MAX_MSG_LENGTH + 1u, 1u,
+                                     &lib_err);
+    msg_res = (CPU_CHAR *)Mem_ArenaAlloc(&AppTaskComArena, MAX_MSG_LENGTH, 1u,
+                                         &lib_err);
+    debug_msg = (CPU_CHAR *)Mem_ArenaAlloc(&AppTaskComArena,
+                                           MAX_MSG_LENGTH + 30u, 1u, &lib_err);
+    if ((msg == NULL) || (msg_res == NULL) || (debug_msg == NULL))
+    {
+      APP_TRACE_DBG("Error Mem_ArenaAlloc: AppTaskCom\n");
+      OSMemSlabPut(&Mem_Slab, p_msg, &err);
+      Mem_ArenaResetToMark(&AppTaskComArena, mark, &lib_err);
+      continue;
+    }
+
+    // obtain message we received; the buffers are not cleared, so
+    // terminate the frame (the echo below also sends msg[msg_size])
     memcpy(msg, (CPU_CHAR *)p_msg, msg_size - 1); // <17>
-    memcpy(msg_res, msg, msg_size - 1);
-    // release the memory partition allocated in the UART service routine
-    OSMemPut(&Mem_Partition, p_msg, &err); // <18>
+    msg[msg_size - 1] = '\0';
+    msg[msg_size] = '\0';
+    memcpy(msg_res, msg, msg_size);
+    // release the memory block allocated in the UART service routine
+    OSMemSlabPut(&Mem_Slab, p_msg, &err); // <18>
     if (err != OS_ERR_NONE)
-      APP_TRACE_DBG("Error OSMemPut: AppTaskCom\n");
+      APP_TRACE_DBG("Error OSMemSlabPut: AppTaskCom\n");
 
     // send ACK in return
     XMC_UART_CH_Transmit(XMC_UART1_CH1, ACK); // <19>
 
-    // print the received message to the debug interface
-    sprintf(debug_msg, "Msg: %s\tLength: %d\n", msg, msg_size - 1); // <20>
+    // print the received message to the debug interface; Str_Fmt_N()
+    // keeps newlib's vfprintf() and its heap out of the frame path
+    Str_Fmt_N(debug_msg, MAX_MSG_LENGTH + 30u, "Msg: %s\tLength: %d\n", msg,
+              msg_size - 1); // <20>
     APP_TRACE_INFO(debug_msg);
 
     // send the received message back via the UART pre-text with "XMC: "
@@ -410,53 +489,56 @@ static void AppTaskCom(void *p_arg)
       XMC_UART_CH_Transmit(XMC_UART1_CH1, msg[i]);
     }
     XMC_UART_CH_Transmit(XMC_UART1_CH1, '\n');
-    //message queue
-    pbuf = (CPU_CHAR *)OSMemGet(&Mem_LED1, &err);
-    get_res = (CPU_CHAR *)OSMemGet(&Mem_RES, &err);
-    pbuf = msg;
     // get RES                              // <5>
-    get_res = msg_res;
     get_res = strtok(msg_res, ":");
     get_res = strtok(NULL, ":");
-    if (strcmp(get_res, "RES") == 0)
+    topics = 0u;
+    opt = OS_OPT_POST_FIFO;
+    if (get_res == NULL)
+    {
+      APP_TRACE_DBG("Error malformed frame: AppTaskCom\n");
+    }
+    else if (strcmp(get_res, "RES") == 0)
     {
       res = true;
-      // the memory block into the queue to the application task
-      OSQPost((OS_Q *)&DATA_Msg,
-              (void *)pbuf,
-              (OS_MSG_SIZE)sizeof(msg),
-              (OS_OPT)OS_OPT_POST_FIFO + OS_OPT_POST_ALL,
-              (OS_ERR *)&err);
-      if (err != OS_ERR_NONE)
-        APP_TRACE_DBG("Error OSQPost: BSP_IntHandler_Uart_Recive\n");
+      topics = APP_CFG_BUS_TOPIC_LED1;
+      // a reset overtakes the blink commands still queued
+      opt = OS_OPT_POST_LIFO;
     }
     else if ((strcmp(get_res, "BL1") == 0) || (strcmp(get_res, "TL1") == 0))
     {
-      // the memory block into the queue to the application task
-      OSQPost((OS_Q *)&DATA_Msg,
-              (void *)pbuf,
-              (OS_MSG_SIZE)sizeof(msg),
-              (OS_OPT)OS_OPT_POST_FIFO,
-              (OS_ERR *)&err);
-      if (err != OS_ERR_NONE)
-        APP_TRACE_DBG("Error OSQPost: BSP_IntHandler_Uart_Recive\n");
+      topics = APP_CFG_BUS_TOPIC_LED1;
     }
     else if ((strcmp(get_res, "BL2") == 0) || (strcmp(get_res, "TL2") == 0))
     {
-      // the memory block into the queue to the application task
-      OSQPost((OS_Q *)&DATA_Msg_led2,
-              (void *)pbuf,
-              (OS_MSG_SIZE)sizeof(msg),
-              (OS_OPT)OS_OPT_POST_FIFO,
-              (OS_ERR *)&err);
+      topics = APP_CFG_BUS_TOPIC_LED2;
+    }
+    if (topics != 0u)
+    {
+      // one copy of the frame is shared by all subscribed LED tasks; the
+      // last one to release it returns it to the slab (AppBusMsgFree())
+      pbuf = (APP_BUS_MSG *)OSMemSlabGet(&Mem_Slab, sizeof(APP_BUS_MSG), &err);
       if (err != OS_ERR_NONE)
-        APP_TRACE_DBG("Error OSQPost: BSP_IntHandler_Uart_Recive\n");
+      {
+        APP_TRACE_DBG("Error OSMemSlabGet: AppTaskCom\n");
+      }
+      else
+      {
+        memcpy(pbuf->Frame, msg, MAX_MSG_LENGTH);
+        OSBusPublish((OS_BUS *)&LED_Bus,
+                     (OS_BUS_MSG *)&pbuf->Hdr,
+                     (OS_FLAGS)topics,
+                     (OS_MSG_SIZE)MAX_MSG_LENGTH,
+                     (OS_OPT)opt,
+                     (OS_ERR *)&err);
+        if (err != OS_ERR_NONE)
+          APP_TRACE_DBG("Error OSBusPublish: AppTaskCom\n");
+      }
     }
     get_res = NULL;
-    // release the memory
-    OSMemPut(&Mem_RES, get_res, &err);
-
     pbuf = NULL;
+    // release all scratch buffers of this frame at once
+    Mem_ArenaResetToMark(&AppTaskComArena, mark, &lib_err);
 
     OSTimeDlyHMSM(0, 0, 0, 1, OS_OPT_TIME_HMSM_STRICT, &err);
   }
@@ -464,7 +546,7 @@ static void AppTaskCom(void *p_arg)
 static void AppTaskLED_1(void *p_arg)
 {
   OS_ERR err;
-  void *p_msg;
+  OS_BUS_MSG *p_msg;
   p_arg = p_arg;
   CPU_TS ts;
   OS_MSG_SIZE msg_size;
@@ -502,18 +584,18 @@ static void AppTaskLED_1(void *p_arg)
       }
     }
     // wait until a message is received
-    p_msg = OSQPend(&DATA_Msg,
-                    1,
-                    OS_OPT_PEND_BLOCKING,
-                    &msg_size,
-                    &ts,
-                    &err);
+    p_msg = OSBusPend(&LED_Sub_led1,
+                      1,
+                      OS_OPT_PEND_BLOCKING,
+                      &msg_size,
+                      &ts,
+                      &err);
     if (err != OS_ERR_NONE)
-      APP_TRACE_DBG("Error OSQPend: AppTaskCom\n");
+      APP_TRACE_DBG("Error OSBusPend: AppTaskCom\n");
     if (p_msg != NULL)
     {
       // obtain message we received
-      memcpy(msg, (CPU_CHAR *)p_msg, msg_size - 1);
+      memcpy(msg, ((APP_BUS_MSG *)p_msg)->Frame, msg_size - 1);
       // get cmd from msg
       cmd = strtok(msg, ":");
       mid = atoi(cmd);
@@ -590,8 +672,8 @@ static void AppTaskLED_1(void *p_arg)
         XMC_UART_CH_Transmit(XMC_UART1_CH1, 'r');
         XMC_UART_CH_Transmit(XMC_UART1_CH1, '\n');
       }
-      // release the memory partition allocated in the UART service routine
-      OSMemPut(&Mem_LED1, p_msg, &err);
+      // release the frame, freed once both LED tasks are done with it
+      OSBusMsgRelease(p_msg, &err);
     }
     if (!pause)
     {
@@ -744,7 +826,7 @@ static void AppTaskLED_1(void *p_arg)
 static void AppTaskLED_2(void *p_arg)
 {
   OS_ERR err;
-  void *p_msg;
+  OS_BUS_MSG *p_msg;
   p_arg = p_arg;
   CPU_TS ts;
   OS_MSG_SIZE msg_size;
@@ -779,18 +861,18 @@ static void AppTaskLED_2(void *p_arg)
       }
     }
     // wait until a message is received
-    p_msg = OSQPend(&DATA_Msg_led2,
-                    1,
-                    OS_OPT_PEND_BLOCKING,
-                    &msg_size,
-                    &ts,
-                    &err);
+    p_msg = OSBusPend(&LED_Sub_led2,
+                      1,
+                      OS_OPT_PEND_BLOCKING,
+                      &msg_size,
+                      &ts,
+                      &err);
     if (err != OS_ERR_NONE)
-      APP_TRACE_DBG("Error OSQPend: AppTaskCom\n");
+      APP_TRACE_DBG("Error OSBusPend: AppTaskCom\n");
     if (p_msg != NULL)
     {
       // obtain message we received
-      memcpy(msg, (CPU_CHAR *)p_msg, msg_size - 1);
+      memcpy(msg, ((APP_BUS_MSG *)p_msg)->Frame, msg_size - 1);
       // get cmd from msg
       cmd = strtok(msg, ":");
       mid = atoi(cmd);
@@ -864,7 +946,7 @@ static void AppTaskLED_2(void *p_arg)
         XMC_UART_CH_Transmit(XMC_UART1_CH1, 'r');
         XMC_UART_CH_Transmit(XMC_UART1_CH1, '\n');
       }
-      OSMemPut(&Mem_LED1, p_msg, &err);
+      OSBusMsgRelease(p_msg, &err);
     }
     if (!pause)
     {
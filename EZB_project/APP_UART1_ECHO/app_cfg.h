@@ -30,10 +30,26 @@
 /************************************************************ TASK PRIORITIES */
 #define  APP_CFG_TASK_START_PRIO  		2u
 #define  APP_CFG_TASK_COM_PRIO     		10u
+/* runs the deferred (task level) part of the UART ISR */
+#define  APP_CFG_TASK_DEFER_PRIO   		3u
 
 /*********************************************************** TASK STACK SIZES */
 #define  APP_CFG_TASK_START_STK_SIZE 	256u
 #define  APP_CFG_TASK_COM_STK_SIZE 		256u
+#define  APP_CFG_TASK_DEFER_STK_SIZE 	256u
+
+/******************************************************* MESSAGE BUFFER SIZES */
+/* largest UART frame payload incl. the terminating NUL (bytes) */
+#define  APP_CFG_MSG_SIZE_MAX 			20u
+/* received bytes the UART ISR may defer before they are framed (power of 2) */
+#define  APP_CFG_UART_DEFER_Q_SIZE 		32u
+/* per-frame scratch memory of AppTaskCom: msg (+1 terminator), msg_res and debug_msg (bytes) */
+#define  APP_CFG_TASK_COM_ARENA_SIZE 	(3u * APP_CFG_MSG_SIZE_MAX + 1u + 30u)
+
+/************************************************************* LED BUS TOPICS */
+/* each LED task subscribes to its own topic, RES is published to LED 1 only */
+#define  APP_CFG_BUS_TOPIC_LED1 		DEF_BIT_00
+#define  APP_CFG_BUS_TOPIC_LED2 		DEF_BIT_01
 
 /************************************************ TRACE / DEBUG CONFIGURATION */
 
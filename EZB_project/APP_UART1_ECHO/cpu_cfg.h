@@ -103,5 +103,33 @@
  */
 #define CPU_CFG_CACHE_MGMT_EN DEF_DISABLED
 
+/****************************************** KERNEL AWARE INTERRUPT PRIORITIES */
+
+/**
+ * @note Configure CPU_CFG_KA_IPL_BOUNDARY with the highest (numerically
+ *       lowest) NVIC priority level allowed to call kernel services.
+ *       (1) 0 keeps the PRIMASK critical sections: the kernel masks every
+ *           interrupt.
+ *       (2) > 0: critical sections raise BASEPRI to this level instead.
+ *           Interrupts with a priority of 0 .. CPU_CFG_KA_IPL_BOUNDARY - 1
+ *           are never masked by the kernel and MUST NOT call any kernel
+ *           service; the tick interrupt is moved to the boundary.
+ *       (3) Plain integers only, the values are also used by 'cpu_a.asm'
+ *           and 'os_cpu_a.asm'.
+ */
+#define CPU_CFG_KA_IPL_BOUNDARY 0
+
+/**
+ * @note Number of priority bits implemented by the NVIC (XMC4500: 6).
+ */
+#define CPU_CFG_NVIC_PRIO_BITS 6
+
+/**
+ * @note Configure CPU_CFG_KA_IPL_CHK_EN to trap (CPU_SW_EXCEPTION()) any
+ *       critical section entered from an interrupt above the boundary.  Meant
+ *       for debug builds, it adds an NVIC read to every critical section.
+ */
+#define CPU_CFG_KA_IPL_CHK_EN DEF_ENABLED
+
 #endif
 /** EOF */
\ No newline at end of file
@@ -60,6 +60,32 @@
 #define LIB_MEM_CFG_HEAP_BASE_ADDR 0x00000000u
 #endif
 
+/**************************************************** TLSF HEAP CONFIGURATION */
+
+/**
+ * @note Configure LIB_MEM_CFG_TLSF_EN to enable/disable the Two-Level
+ *       Segregated Fit heap, Mem_TLSF_xxx().
+ *       DEF_DISABLED     TLSF heap DISABLED
+ *       DEF_ENABLED      TLSF heap ENABLED
+ */
+#define LIB_MEM_CFG_TLSF_EN DEF_ENABLED
+
+/**
+ * @note Configure LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 with the base-2 logarithm of
+ *       the largest TLSF heap (in octets).
+ */
+#define LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 16u
+
+/************************************************* MEMORY ARENA CONFIGURATION */
+
+/**
+ * @note Configure LIB_MEM_CFG_ARENA_EN to enable/disable memory arenas,
+ *       Mem_ArenaXXX().
+ *       DEF_DISABLED     Memory arenas DISABLED
+ *       DEF_ENABLED      Memory arenas ENABLED
+ */
+#define LIB_MEM_CFG_ARENA_EN DEF_ENABLED
+
 /******************************************************************************/
 /*********************************************** STRING LIBRARY CONFIGURATION */
 
@@ -81,5 +107,16 @@
  */
 #define LIB_STR_CFG_FP_MAX_NBR_DIG_SIG LIB_STR_FP_MAX_NBR_DIG_SIG_DFLT
 
+/******************************************* STRING WORD ACCESS CONFIGURATION */
+
+/**
+ * @note Configure LIB_STR_CFG_WORD_EN to enable/disable scanning strings a
+ *       32-bit word at a time in Str_Len(), Str_Copy(), Str_Cat(), Str_Cmp(),
+ *       Str_Char() and their _N() variants.
+ *       DEF_DISABLED     Octet-at-a-time string functions
+ *       DEF_ENABLED      Word-at-a-time  string functions
+ */
+#define LIB_STR_CFG_WORD_EN DEF_ENABLED
+
 #endif
 /** EOF */
@@ -21,6 +21,9 @@
 /* Enable (1) debug code/variables */
 #define OS_CFG_DBG_EN                   1u
 
+/* Enable (1) or Disable (0) deferred work queues run by tasks on behalf of ISRs (OSDeferQXXX()) */
+#define OS_CFG_DEFER_Q_EN               1u
+
 /* Enable (1) or Disable (0) Deferred ISR posts */
 #define OS_CFG_ISR_POST_DEFERRED_EN     0u
 
@@ -33,6 +36,12 @@
 /* Enable (1) or Disable (0) code generation for multi-pend feature */
 #define OS_CFG_PEND_MULTI_EN            1u
 
+/* Enable (1) or Disable (0) persistent wait sets of semaphores/queues (OSWaitSetXXX()) */
+#define OS_CFG_WAIT_SET_EN              0u
+
+/* Enable (1) or Disable (0) work queues distributing items to worker tasks (OSWorkQXXX()) */
+#define OS_CFG_WORK_Q_EN                0u
+
 /* Defines the maximum number of task priorities (see OS_PRIO data type) */
 #define OS_CFG_PRIO_MAX                32u
 
@@ -42,6 +51,18 @@
 /* Include code for Round-Robin scheduling */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN     0u
 
+/* Include code for Earliest-Deadline-First scheduling at one priority level (OSTaskEDFXXX()) */
+#define OS_CFG_SCHED_EDF_EN             0u
+
+/* Priority level scheduled Earliest-Deadline-First */
+#define OS_CFG_SCHED_EDF_PRIO           8u
+
+/* EDF admission bound, in units of 0.01% of the CPU */
+#define OS_CFG_SCHED_EDF_UTIL_MAX   10000u
+
+/* Include code for time-triggered schedule tables (OSSchedTblXXX()) */
+#define OS_CFG_SCHED_TBL_EN             0u
+
 /* Minimum allowable task stack size  */
 #define OS_CFG_STK_SIZE_MIN            64u
 
@@ -64,6 +85,14 @@
 /* Enable (1) or Disable (0) code generation for MEMORY MANAGER */
 #define OS_CFG_MEM_EN                   1u
 
+/* Include code for the size-class allocator OSMemSlabXXX() */
+#define OS_CFG_MEM_SLAB_EN              1u
+
+/* Include code for the per-task magazine caches OSMemMagXXX() */
+#define OS_CFG_MEM_MAG_EN               0u
+/* Number of blocks a magazine can cache (half of it is moved per refill/drain) */
+#define OS_CFG_MEM_MAG_SIZE             8u
+
 /************************************************ MUTUAL EXCLUSION SEMAPHORES */
 /* Enable (1) or Disable (0) code generation for MUTEX */
 #define OS_CFG_MUTEX_EN                 1u
@@ -74,6 +103,9 @@
 /* Include code for OSMutexPendAbort() */
 #define OS_CFG_MUTEX_PEND_ABORT_EN      0u
 
+/* Include code for OSMutexCreateExt() and immediate priority-ceiling mutexes */
+#define OS_CFG_MUTEX_CEILING_EN         0u
+
 /************************************************************* MESSAGE QUEUES */
 /* Enable (1) or Disable (0) code generation for QUEUES */
 #define OS_CFG_Q_EN                     1u
@@ -87,6 +119,35 @@
 /* Include code for OSQPendAbort() */
 #define OS_CFG_Q_PEND_ABORT_EN          1u
 
+/* Include code for OSQPostPrio(), messages ordered by priority */
+#define OS_CFG_Q_PRIO_EN                0u
+
+/* Number of message priorities (1 to 32) */
+#define OS_CFG_Q_PRIO_LEVELS            4u
+
+/* Include code for publish/subscribe buses over message queues (OSBusXXX()) */
+#define OS_CFG_BUS_EN                   1u
+
+/* Maximum number of subscribers per bus (1 to 32) */
+#define OS_CFG_BUS_SUB_MAX              4u
+
+/* Number of topics per bus (1 to 32) */
+#define OS_CFG_BUS_TOPIC_MAX            8u
+
+/******************************************************** READER-WRITER LOCKS */
+/* Enable (1) or Disable (0) code generation for reader-writer locks */
+#define OS_CFG_RWLOCK_EN                0u
+
+/* Include code for OSRWLockDel() */
+#define OS_CFG_RWLOCK_DEL_EN            0u
+
+/************************************************************* SEQUENCE LOCKS */
+/* Enable (1) or Disable (0) code generation for sequence locks */
+#define OS_CFG_SEQLOCK_EN               1u
+
+/* Number of attempts of OSSeqLockRead() while the record is being written */
+#define OS_CFG_SEQLOCK_RD_RETRY_MAX     4u
+
 /***************************************************************** SEMAPHORES */
 /* Enable (1) or Disable (0) code generation for SEMAPHORES */
 #define OS_CFG_SEM_EN                   1u
@@ -100,6 +161,9 @@
 /* Include code for OSSemSet() */
 #define OS_CFG_SEM_SET_EN               1u
 
+/* Enable (1) or Disable (0) the lock-free (LDREX/STREX) OSSemPend()/OSSemPost() fast path */
+#define OS_CFG_SEM_FAST_EN              0u
+
 /************************************************************ TASK MANAGEMENT */
 /* Enable (1) or Disable(0) the statistics task */
 #define OS_CFG_STAT_TASK_EN             1u
@@ -139,6 +203,15 @@
 /* Include code for OSTimeDlyResume() */
 #define OS_CFG_TIME_DLY_RESUME_EN       0u
 
+/* Include code for OSTimeDlyCycles()/OSTimeDlyUs() and sub-tick pend timeouts */
+#define OS_CFG_TIME_HR_EN               0u
+
+/* Process ticks in the tick ISR instead of the tick task when few tasks become ready */
+#define OS_CFG_TICK_DIRECT_EN           1u
+
+/* Maximum number of tasks made ready by one tick in the tick ISR, busier ticks go to the tick task */
+#define OS_CFG_TICK_DIRECT_BUDGET       4u
+
 /********************************************** TASK LOCAL STORAGE MANAGEMENT */
 /* Include code for Task Local Storage (TLS) registers */
 #define OS_CFG_TLS_TBL_SIZE             0u
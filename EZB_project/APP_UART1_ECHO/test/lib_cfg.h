@@ -0,0 +1,37 @@
+/**
+ * @file test/lib_cfg.h
+ *
+ * @brief HOST TEST LIBRARY CONFIGURATION FILE
+ *
+ * The application's uC-LIB configuration, adapted for the host-side tests
+ * built by 'make test'.
+ */
+#ifndef  TEST_LIB_CFG_MODULE_PRESENT
+#define  TEST_LIB_CFG_MODULE_PRESENT
+
+#include "../lib_cfg.h"
+
+/**
+ * @note Mem_Copy() & friends are only available in C on the host.
+ */
+#undef  LIB_MEM_CFG_OPTIMIZE_ASM_EN
+#define LIB_MEM_CFG_OPTIMIZE_ASM_EN DEF_DISABLED
+
+/**
+ * @note The TLSF fuzz driver also exercises the argument and double free
+ *       checks.
+ */
+#undef  LIB_MEM_CFG_ARG_CHK_EXT_EN
+#define LIB_MEM_CFG_ARG_CHK_EXT_EN DEF_ENABLED
+
+/**
+ * @note lib_str_ref.c builds the octet-at-a-time reference that the word
+ *       access string functions are checked against.
+ */
+#ifdef  LIB_STR_TEST_REF
+#undef  LIB_STR_CFG_WORD_EN
+#define LIB_STR_CFG_WORD_EN DEF_DISABLED
+#endif
+
+#endif
+/** EOF */
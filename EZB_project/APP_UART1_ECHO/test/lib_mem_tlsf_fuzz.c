@@ -0,0 +1,471 @@
+/**
+ * \file lib_mem_tlsf_fuzz.c
+ *
+ * Host-side fuzz driver and benchmark for the uC-LIB TLSF heap
+ * (Mem_TLSF_xxx(), see 'lib_mem.h TLSF HEAP DATA TYPES').
+ *
+ * Random sequences of allocations, frees and reallocations (allocate, copy,
+ * free, as an application would do it with this API) are run on one heap.
+ * After every operation the whole heap is checked:
+ *  - the physical block chain covers the heap exactly, with matching
+ *    PrevPhysPtr links, aligned sizes, no two adjacent free blocks and an
+ *    allocated zero-size sentinel at the end;
+ *  - every free block is in exactly the free list its size maps to, the free
+ *    lists are doubly linked, and a list is non-empty if & only if its
+ *    second-level bit and its class's first-level bit are set;
+ *  - the free size and block counters match the walk;
+ *  - no allocated block was overwritten (each holds a fill pattern);
+ *  - an allocation only fails if no free block is clearly large enough.
+ * Free errors (double free, pointer outside of or inside a block) are
+ * checked too, and the lock functions must be called in pairs.
+ *
+ * lib_mem.c is included rather than linked so that the checks can use its
+ * local block macros and Mem_TLSF_MapGet().
+ *
+ * Build and run: make test_tlsf   [args: test/lib_mem_tlsf_fuzz seed ops]
+ */
+
+/******************************************************************* INCLUDES */
+#include <lib_mem.c>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/******************************************************************** DEFINES */
+#define HEAP_SIZE (32u * 1024u)
+#define SLOT_NBR 256u              // live allocations at most
+#define OP_NBR_DFLT 300000ul
+#define FAIL_PRINT_MAX 10
+
+#define BENCH_OPS 2000000ul
+
+/********************************************************************** TYPES */
+typedef struct
+{
+  CPU_INT08U *Ptr;                 // DEF_NULL if the slot is unused
+  CPU_SIZE_T Size;
+  CPU_INT08U Fill;
+} SLOT;
+
+/********************************************************* FILE LOCAL GLOBALS */
+// Static, so below 4 GiB: CPU_ADDR is 32 bits wide in the Cortex-M4 port
+static CPU_ALIGN SegBuf[(HEAP_SIZE + 64u) / sizeof(CPU_ALIGN)];
+static MEM_SEG Seg;
+static MEM_TLSF Heap;
+
+static SLOT Slots[SLOT_NBR];
+
+static unsigned long OpCtr;
+static unsigned long FailCtr;
+static unsigned long RandSeed = 1u;
+
+static int LockNesting;
+static unsigned long LockCtr;
+
+/********************************************************** CPU PORT (HOST) */
+CPU_SR CPU_SR_Save(void)
+{
+  return ((CPU_SR)0);
+}
+
+void CPU_SR_Restore(CPU_SR cpu_sr)
+{
+  (void)cpu_sr;
+}
+
+void CPU_SW_Exception(void)
+{
+  printf("CPU_SW_Exception()\n");
+  exit(EXIT_FAILURE);
+}
+
+CPU_DATA CPU_CntLeadZeros(CPU_DATA val)
+{
+  return ((val == 0u) ? 32u : (CPU_DATA)__builtin_clz(val));
+}
+
+CPU_DATA CPU_CntTrailZeros(CPU_DATA val)
+{
+  return ((val == 0u) ? 32u : (CPU_DATA)__builtin_ctz(val));
+}
+
+/********************************************************** LOCAL FUNCTIONS */
+static unsigned int RandGet(void)
+{
+  RandSeed = RandSeed * 1103515245u + 12345u;
+  return (unsigned int)(RandSeed >> 8) & 0xFFFFFFu;
+}
+
+static void Fail(const char *what)
+{
+  FailCtr++;
+  if (FailCtr <= FAIL_PRINT_MAX) {
+    printf("FAIL op %lu: %s\n", OpCtr, what);
+  }
+}
+
+#define CHK(cond, what) \
+  if (!(cond)) { Fail(what); }
+
+static void Lock(void *p_arg)
+{
+  CHK(p_arg == &Heap, "lock arg");
+  CHK(LockNesting == 0, "lock nested");
+  LockNesting++;
+  LockCtr++;
+}
+
+static void Unlock(void *p_arg)
+{
+  CHK(p_arg == &Heap, "unlock arg");
+  CHK(LockNesting == 1, "unlock without lock");
+  LockNesting--;
+}
+
+// Mostly small blocks, some large ones, and a few too large for the heap
+static CPU_SIZE_T SizeGet(void)
+{
+  unsigned int r = RandGet() % 100u;
+
+  if (r < 60u) {
+    return (1u + RandGet() % 64u);
+  } else if (r < 90u) {
+    return (65u + RandGet() % 960u);
+  } else if (r < 99u) {
+    return (1025u + RandGet() % 7168u);
+  }
+  return (HEAP_SIZE / 2u + RandGet() % (2u * HEAP_SIZE));
+}
+
+static void SlotFill(SLOT *p_slot)
+{
+  p_slot->Fill = (CPU_INT08U)(1u + RandGet() % 255u);
+  memset(p_slot->Ptr, p_slot->Fill, p_slot->Size);
+}
+
+static void SlotChk(const SLOT *p_slot)
+{
+  CPU_SIZE_T i;
+
+  for (i = 0u; i < p_slot->Size; i++) {
+    if (p_slot->Ptr[i] != p_slot->Fill) {
+      Fail("allocated block overwritten");
+      return;
+    }
+  }
+}
+
+// Size of the largest free block, from the physical walk
+static CPU_SIZE_T FreeBlkSizeMaxGet(void)
+{
+  MEM_TLSF_BLK *p_blk;
+  CPU_SIZE_T size_max = 0u;
+
+  for (p_blk = Heap.BlkFirstPtr; p_blk != Heap.BlkEndPtr;
+       p_blk = MEM_TLSF_BLK_NEXT(p_blk)) {
+    if (MEM_TLSF_BLK_IS_FREE(p_blk) &&
+        (MEM_TLSF_BLK_SIZE_GET(p_blk) > size_max)) {
+      size_max = MEM_TLSF_BLK_SIZE_GET(p_blk);
+    }
+  }
+  return (size_max);
+}
+
+// Heap structure invariants (see file header)
+static void HeapChk(void)
+{
+  MEM_TLSF_BLK *p_blk;
+  MEM_TLSF_BLK *p_prev;
+  CPU_SIZE_T free_size = 0u;
+  CPU_SIZE_T free_cnt = 0u;
+  CPU_SIZE_T used_cnt = 0u;
+  CPU_SIZE_T list_cnt = 0u;
+  CPU_SIZE_T total = 0u;
+  CPU_DATA fl;
+  CPU_DATA sl;
+  CPU_DATA fl_blk;
+  CPU_DATA sl_blk;
+  CPU_BOOLEAN prev_free = DEF_NO;
+
+  p_prev = DEF_NULL;                                   // physical chain
+  for (p_blk = Heap.BlkFirstPtr; p_blk != Heap.BlkEndPtr;
+       p_blk = MEM_TLSF_BLK_NEXT(p_blk)) {
+    if ((CPU_INT08U *)p_blk >= (CPU_INT08U *)Heap.BlkFirstPtr + Heap.TotalSize) {
+      Fail("block chain runs past the heap");
+      return;
+    }
+    CHK(p_blk->PrevPhysPtr == p_prev, "PrevPhysPtr");
+    CHK(MEM_TLSF_BLK_SIZE_GET(p_blk) % LIB_MEM_TLSF_ALIGN == 0u, "block size not aligned");
+    CHK(MEM_TLSF_BLK_SIZE_GET(p_blk) >= MEM_TLSF_BLK_SIZE_MIN, "block size below minimum");
+    if (MEM_TLSF_BLK_IS_FREE(p_blk)) {
+      CHK(prev_free == DEF_NO, "two adjacent free blocks");
+      free_size += MEM_TLSF_BLK_SIZE_GET(p_blk);
+      free_cnt++;
+    } else {
+      used_cnt++;
+    }
+    prev_free = MEM_TLSF_BLK_IS_FREE(p_blk);
+    total += MEM_TLSF_BLK_HDR_SIZE + MEM_TLSF_BLK_SIZE_GET(p_blk);
+    p_prev = p_blk;
+  }
+  CHK(Heap.BlkEndPtr->PrevPhysPtr == p_prev, "sentinel PrevPhysPtr");
+  CHK(Heap.BlkEndPtr->Size == 0u, "sentinel not an allocated empty block");
+  CHK(total + MEM_TLSF_BLK_HDR_SIZE == Heap.TotalSize, "blocks do not cover the heap");
+  CHK(free_size == Heap.FreeSize, "FreeSize");
+  CHK(free_cnt == Heap.FreeBlkCnt, "FreeBlkCnt");
+  CHK(used_cnt == Heap.UsedBlkCnt, "UsedBlkCnt");
+  CHK(Heap.FreeSizeMin <= Heap.FreeSize, "FreeSizeMin");
+
+  for (fl = 0u; fl < LIB_MEM_TLSF_FL_NBR; fl++) {      // free lists & bitmaps
+    CHK(DEF_BIT_IS_SET(Heap.FlBitmap, DEF_BIT(fl)) == (Heap.SlBitmap[fl] != 0u),
+        "first-level bit does not match its second-level bitmap");
+    for (sl = 0u; sl < LIB_MEM_TLSF_SL_NBR; sl++) {
+      p_blk = Heap.FreeTbl[fl][sl];
+      CHK(DEF_BIT_IS_SET(Heap.SlBitmap[fl], DEF_BIT(sl)) == (p_blk != DEF_NULL),
+          "second-level bit does not match its free list");
+      p_prev = DEF_NULL;
+      while (p_blk != DEF_NULL) {
+        if (list_cnt++ > Heap.FreeBlkCnt) {
+          Fail("free list loops");
+          return;
+        }
+        CHK(MEM_TLSF_BLK_IS_FREE(p_blk), "allocated block in a free list");
+        CHK(p_blk->PrevFreePtr == p_prev, "PrevFreePtr");
+        Mem_TLSF_MapGet(MEM_TLSF_BLK_SIZE_GET(p_blk), &fl_blk, &sl_blk);
+        CHK((fl_blk == fl) && (sl_blk == sl), "free block in the wrong list");
+        p_prev = p_blk;
+        p_blk = p_blk->NextFreePtr;
+      }
+    }
+  }
+  CHK(list_cnt == Heap.FreeBlkCnt, "free blocks missing from the free lists");
+  CHK(LockNesting == 0, "lock left held");
+}
+
+// An allocation may only fail if no free block is clearly large enough; the
+// search rounds up to the next free list (see 'Mem_TLSF_Alloc() Note #2')
+static void AllocFailChk(CPU_SIZE_T size)
+{
+  CPU_SIZE_T size_round;
+
+  if (size > MEM_TLSF_BLK_SIZE_MAX) {
+    return;
+  }
+  size_round = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_TLSF_ALIGN);
+  CHK(FreeBlkSizeMaxGet() < size_round + size_round / 8u + LIB_MEM_TLSF_ALIGN,
+      "allocation failed with a large enough free block");
+}
+
+static void OpAlloc(SLOT *p_slot)
+{
+  LIB_ERR err;
+  CPU_SIZE_T size = SizeGet();
+
+  p_slot->Ptr = (CPU_INT08U *)Mem_TLSF_Alloc(&Heap, size, &err);
+  if (p_slot->Ptr == DEF_NULL) {
+    CHK(err == LIB_MEM_ERR_HEAP_OVF, "alloc error code");
+    AllocFailChk(size);
+    return;
+  }
+  CHK(err == LIB_MEM_ERR_NONE, "alloc error code");
+  CHK(((CPU_INT08U *)p_slot->Ptr - (CPU_INT08U *)Heap.BlkFirstPtr) %
+          LIB_MEM_TLSF_ALIGN == 0u, "block not aligned");
+  CHK(MEM_TLSF_BLK_SIZE_GET(MEM_TLSF_PTR_TO_BLK(p_slot->Ptr)) >= size,
+      "block smaller than requested");
+  p_slot->Size = size;
+  SlotFill(p_slot);
+}
+
+static void OpFree(SLOT *p_slot)
+{
+  LIB_ERR err;
+
+  SlotChk(p_slot);
+  Mem_TLSF_Free(&Heap, p_slot->Ptr, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "free error code");
+  if (RandGet() % 16u == 0u) {                         // free it again
+    Mem_TLSF_Free(&Heap, p_slot->Ptr, &err);
+    CHK(err == LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL, "double free not caught");
+  }
+  p_slot->Ptr = DEF_NULL;
+}
+
+// Grow or shrink a block: allocate, copy, free; keep the old one on failure
+static void OpRealloc(SLOT *p_slot)
+{
+  LIB_ERR err;
+  CPU_INT08U *p_new;
+  CPU_SIZE_T size = SizeGet();
+
+  SlotChk(p_slot);
+  p_new = (CPU_INT08U *)Mem_TLSF_Alloc(&Heap, size, &err);
+  if (p_new == DEF_NULL) {
+    AllocFailChk(size);
+    return;
+  }
+  memcpy(p_new, p_slot->Ptr, (size < p_slot->Size) ? size : p_slot->Size);
+  Mem_TLSF_Free(&Heap, p_slot->Ptr, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "realloc free error code");
+  p_slot->Ptr = p_new;
+  p_slot->Size = size;
+  SlotFill(p_slot);
+}
+
+// Bad pointers must be rejected without touching the heap
+static void OpFreeBad(void)
+{
+  LIB_ERR err;
+  SLOT *p_slot = &Slots[RandGet() % SLOT_NBR];
+
+  Mem_TLSF_Free(&Heap, (CPU_INT08U *)SegBuf + sizeof(SegBuf) + 64u, &err);
+  CHK(err == LIB_MEM_ERR_INVALID_BLK_ADDR, "free outside of the heap");
+  if ((p_slot->Ptr != DEF_NULL) && (p_slot->Size > 1u)) {
+    Mem_TLSF_Free(&Heap, p_slot->Ptr + 1u, &err);
+    CHK(err == LIB_MEM_ERR_INVALID_BLK_ADDR, "free inside a block");
+  }
+}
+
+static void InfoChk(void)
+{
+  MEM_TLSF_INFO info;
+  LIB_ERR err;
+
+  Mem_TLSF_InfoGet(&Heap, &info, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "info error code");
+  CHK(info.FreeBlkSizeMax == FreeBlkSizeMaxGet(), "info FreeBlkSizeMax");
+  CHK(info.FreeSize == Heap.FreeSize, "info FreeSize");
+  CHK(info.FragPct == ((info.FreeSize == 0u) ? 0u
+                       : (info.FreeSize - info.FreeBlkSizeMax) * 100u / info.FreeSize),
+      "info FragPct");
+}
+
+static void FuzzRun(unsigned long op_nbr)
+{
+  LIB_ERR err;
+  SLOT *p_slot;
+  unsigned int r;
+  CPU_SIZE_T free_size_init;
+
+  Mem_SegCreate("TLSF fuzz seg", &Seg, (CPU_ADDR)SegBuf, sizeof(SegBuf),
+                LIB_MEM_PADDING_ALIGN_NONE, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "Mem_SegCreate()");
+  Mem_TLSF_Create("TLSF fuzz heap", &Heap, &Seg, HEAP_SIZE, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "Mem_TLSF_Create()");
+  Mem_TLSF_LockSet(&Heap, Lock, Unlock, &Heap, &err);
+  CHK(err == LIB_MEM_ERR_NONE, "Mem_TLSF_LockSet()");
+  if (FailCtr != 0u) {
+    return;
+  }
+  free_size_init = Heap.FreeSize;
+  HeapChk();
+
+  for (OpCtr = 1u; OpCtr <= op_nbr; OpCtr++) {
+    p_slot = &Slots[RandGet() % SLOT_NBR];
+    r = RandGet() % 100u;
+    if (p_slot->Ptr == DEF_NULL) {
+      OpAlloc(p_slot);
+    } else if (r < 45u) {
+      OpFree(p_slot);
+    } else if (r < 95u) {
+      OpRealloc(p_slot);
+    } else {
+      OpFreeBad();
+    }
+    HeapChk();
+    if (OpCtr % 1024u == 0u) {
+      InfoChk();
+    }
+    if (FailCtr > FAIL_PRINT_MAX) {
+      return;
+    }
+  }
+
+  for (p_slot = &Slots[0]; p_slot < &Slots[SLOT_NBR]; p_slot++) {
+    if (p_slot->Ptr != DEF_NULL) {                     // free everything ...
+      OpFree(p_slot);
+    }
+  }
+  HeapChk();
+  CHK(Heap.FreeBlkCnt == 1u, "heap not coalesced back to one block");
+  CHK(Heap.FreeSize == free_size_init, "free size not restored");
+  CHK(LockCtr > op_nbr, "lock functions not called");
+}
+
+static double NsPerOp(clock_t start)
+{
+  return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_OPS;
+}
+
+// Same random alloc/free sequence on the TLSF heap and the host's malloc()
+static void BenchRun(void)
+{
+  static void *ptr_tbl[SLOT_NBR];
+  LIB_ERR err;
+  clock_t start;
+  unsigned long n;
+  unsigned int i;
+  double ns_tlsf;
+
+  Mem_TLSF_LockSet(&Heap, DEF_NULL, DEF_NULL, DEF_NULL, &err);
+
+  RandSeed = 1u;
+  start = clock();
+  for (n = 0u; n < BENCH_OPS; n++) {
+    i = RandGet() % SLOT_NBR;
+    if (ptr_tbl[i] == DEF_NULL) {
+      ptr_tbl[i] = Mem_TLSF_Alloc(&Heap, 1u + RandGet() % 512u, &err);
+    } else {
+      Mem_TLSF_Free(&Heap, ptr_tbl[i], &err);
+      ptr_tbl[i] = DEF_NULL;
+    }
+  }
+  ns_tlsf = NsPerOp(start);
+  for (i = 0u; i < SLOT_NBR; i++) {
+    if (ptr_tbl[i] != DEF_NULL) {
+      Mem_TLSF_Free(&Heap, ptr_tbl[i], &err);
+      ptr_tbl[i] = DEF_NULL;
+    }
+  }
+
+  RandSeed = 1u;
+  start = clock();
+  for (n = 0u; n < BENCH_OPS; n++) {
+    i = RandGet() % SLOT_NBR;
+    if (ptr_tbl[i] == DEF_NULL) {
+      ptr_tbl[i] = malloc(1u + RandGet() % 512u);
+    } else {
+      free(ptr_tbl[i]);
+      ptr_tbl[i] = DEF_NULL;
+    }
+  }
+  printf("alloc/free [ns/op]: TLSF %.1f, host malloc %.1f\n", ns_tlsf,
+         NsPerOp(start));
+  for (i = 0u; i < SLOT_NBR; i++) {
+    free(ptr_tbl[i]);
+  }
+}
+
+/**********************************************************************  MAIN */
+int main(int argc, char *argv[])
+{
+  unsigned long op_nbr = OP_NBR_DFLT;
+
+  if (argc > 1) {
+    RandSeed = strtoul(argv[1], DEF_NULL, 0);
+  }
+  if (argc > 2) {
+    op_nbr = strtoul(argv[2], DEF_NULL, 0);
+  }
+  printf("lib_mem_tlsf_fuzz: seed %lu, %lu ops\n", RandSeed, op_nbr);
+
+  FuzzRun(op_nbr);
+  printf("lib_mem_tlsf_fuzz: %lu failures\n", FailCtr);
+
+  if (FailCtr == 0u) {
+    BenchRun();
+  }
+  return (FailCtr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/** EOF */
@@ -0,0 +1,39 @@
+/**
+ * \file lib_str_ref.c
+ *
+ * Octet-at-a-time build of uC-LIB's lib_str.c, with every global renamed
+ * Ref_xxx(), so that lib_str_test.c can check the word access functions
+ * against it in the same program.
+ */
+
+/******************************************************************* INCLUDES */
+#define LIB_STR_TEST_REF                                        // see lib_cfg.h
+
+#define Str_Cat                 Ref_Str_Cat
+#define Str_Cat_N               Ref_Str_Cat_N
+#define Str_Char                Ref_Str_Char
+#define Str_Char_Last           Ref_Str_Char_Last
+#define Str_Char_Last_N         Ref_Str_Char_Last_N
+#define Str_Char_N              Ref_Str_Char_N
+#define Str_Char_Replace        Ref_Str_Char_Replace
+#define Str_Char_Replace_N      Ref_Str_Char_Replace_N
+#define Str_Cmp                 Ref_Str_Cmp
+#define Str_CmpIgnoreCase       Ref_Str_CmpIgnoreCase
+#define Str_CmpIgnoreCase_N     Ref_Str_CmpIgnoreCase_N
+#define Str_Cmp_N               Ref_Str_Cmp_N
+#define Str_Copy                Ref_Str_Copy
+#define Str_Copy_N              Ref_Str_Copy_N
+#define Str_FmtNbr_Int32S       Ref_Str_FmtNbr_Int32S
+#define Str_FmtNbr_Int32U       Ref_Str_FmtNbr_Int32U
+#define Str_FmtNbr_32           Ref_Str_FmtNbr_32
+#define Str_Fmt_N               Ref_Str_Fmt_N
+#define Str_Len                 Ref_Str_Len
+#define Str_Len_N               Ref_Str_Len_N
+#define Str_ParseNbr_Int32S     Ref_Str_ParseNbr_Int32S
+#define Str_ParseNbr_Int32U     Ref_Str_ParseNbr_Int32U
+#define Str_SrchPatInit         Ref_Str_SrchPatInit
+#define Str_SrchPat_N           Ref_Str_SrchPat_N
+#define Str_Str                 Ref_Str_Str
+#define Str_Str_N               Ref_Str_Str_N
+
+#include <lib_str.c>
@@ -0,0 +1,275 @@
+/**
+ * \file lib_str_test.c
+ *
+ * Host-side equivalence test and benchmark for the word access string
+ * functions of uC-LIB (LIB_STR_CFG_WORD_EN, see 'lib_str.c Str_WordSkip()').
+ *
+ * Str_Len(), Str_Copy(), Str_Cat(), Str_Cmp(), Str_Char(), Str_Str() and
+ * their _N() variants are run against the octet-at-a-time build of the same
+ * source (lib_str_ref.c) over every string length up to a few words, every
+ * alignment of source and destination, and lengths limits around the word
+ * boundaries; then over random strings.  Return values, and for copies the
+ * whole destination buffer, must be identical.
+ *
+ * Build and run: make test_str
+ */
+
+/******************************************************************* INCLUDES */
+#include <lib_str.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/******************************************************************** DEFINES */
+#define LEN_MAX 67                 // string lengths 0..LEN_MAX, i.e. 16 words+
+#define ALIGN_NBR 4                // every offset within a 32-bit word
+#define BUF_SIZE (2 * LEN_MAX + 16)
+#define RAND_NBR 200000            // random cases after the exhaustive ones
+#define FAIL_PRINT_MAX 10
+
+#define BENCH_CALLS 200000
+
+/************************************************************ REFERENCE BUILD */
+CPU_SIZE_T Ref_Str_Len(const CPU_CHAR *pstr);
+CPU_SIZE_T Ref_Str_Len_N(const CPU_CHAR *pstr, CPU_SIZE_T len_max);
+CPU_CHAR *Ref_Str_Copy(CPU_CHAR *pstr_dest, const CPU_CHAR *pstr_src);
+CPU_CHAR *Ref_Str_Copy_N(CPU_CHAR *pstr_dest, const CPU_CHAR *pstr_src,
+                         CPU_SIZE_T len_max);
+CPU_CHAR *Ref_Str_Cat(CPU_CHAR *pstr_dest, const CPU_CHAR *pstr_cat);
+CPU_CHAR *Ref_Str_Cat_N(CPU_CHAR *pstr_dest, const CPU_CHAR *pstr_cat,
+                        CPU_SIZE_T len_max);
+CPU_INT16S Ref_Str_Cmp(const CPU_CHAR *p1_str, const CPU_CHAR *p2_str);
+CPU_INT16S Ref_Str_Cmp_N(const CPU_CHAR *p1_str, const CPU_CHAR *p2_str,
+                         CPU_SIZE_T len_max);
+CPU_CHAR *Ref_Str_Char(const CPU_CHAR *pstr, CPU_CHAR srch_char);
+CPU_CHAR *Ref_Str_Char_N(const CPU_CHAR *pstr, CPU_SIZE_T len_max,
+                         CPU_CHAR srch_char);
+CPU_CHAR *Ref_Str_Str(const CPU_CHAR *pstr, const CPU_CHAR *pstr_srch);
+CPU_CHAR *Ref_Str_Str_N(const CPU_CHAR *pstr, const CPU_CHAR *pstr_srch,
+                        CPU_SIZE_T len_max);
+
+/********************************************************* FILE LOCAL GLOBALS */
+// Strings are built in word-aligned buffers, then used from an offset
+static CPU_INT32U Buf1[BUF_SIZE / 4];
+static CPU_INT32U Buf2[BUF_SIZE / 4];
+static CPU_INT32U Dest1[2 * BUF_SIZE / 4];
+static CPU_INT32U Dest2[2 * BUF_SIZE / 4];
+
+static unsigned long CaseCtr;
+static unsigned long FailCtr;
+static unsigned long RandSeed = 1u;
+
+/********************************************************** LOCAL FUNCTIONS */
+static unsigned int RandGet(void)
+{
+  RandSeed = RandSeed * 1103515245u + 12345u;
+  return (unsigned int)(RandSeed >> 8) & 0xFFFFFFu;
+}
+
+static void Fail(const char *what, int len1, int off1, int len2, int off2,
+                 CPU_SIZE_T len_max)
+{
+  FailCtr++;
+  if (FailCtr <= FAIL_PRINT_MAX) {
+    printf("FAIL %s: len1=%d off1=%d len2=%d off2=%d len_max=%lu\n", what,
+           len1, off1, len2, off2, (unsigned long)len_max);
+  }
+}
+
+// Fill 'len' characters, none of them NUL; 'alpha' > 0 restricts them to a
+// small alphabet so that strings often match
+static void StrFill(CPU_CHAR *pstr, int len, int alpha)
+{
+  int i;
+
+  for (i = 0; i < len; i++) {
+    if (alpha > 0) {
+      pstr[i] = (CPU_CHAR)('a' + RandGet() % alpha);
+    } else {
+      pstr[i] = (CPU_CHAR)(1u + RandGet() % 255u); // incl. 0x80..0xFF
+    }
+  }
+  pstr[len] = '\0';
+}
+
+// Run every function on one pair of strings and compare with the reference
+static void CaseRun(const CPU_CHAR *p1, int len1, int off1, const CPU_CHAR *p2,
+                    int len2, int off2, CPU_SIZE_T len_max, CPU_CHAR srch_char)
+{
+  CPU_CHAR *d1 = (CPU_CHAR *)Dest1 + off2;
+  CPU_CHAR *d2 = (CPU_CHAR *)Dest2 + off2;
+
+  CaseCtr++;
+
+#define CHK(cond, what) \
+  if (!(cond)) { Fail(what, len1, off1, len2, off2, len_max); }
+#define CHK_DEST(what) \
+  CHK(memcmp(Dest1, Dest2, sizeof(Dest1)) == 0, what " (dest)")
+
+  CHK(Str_Len(p1) == Ref_Str_Len(p1), "Str_Len");
+  CHK(Str_Len_N(p1, len_max) == Ref_Str_Len_N(p1, len_max), "Str_Len_N");
+
+  CHK(Str_Cmp(p1, p2) == Ref_Str_Cmp(p1, p2), "Str_Cmp");
+  CHK(Str_Cmp_N(p1, p2, len_max) == Ref_Str_Cmp_N(p1, p2, len_max),
+      "Str_Cmp_N");
+
+  CHK(Str_Char(p1, srch_char) == Ref_Str_Char(p1, srch_char), "Str_Char");
+  CHK(Str_Char_N(p1, len_max, srch_char) ==
+          Ref_Str_Char_N(p1, len_max, srch_char),
+      "Str_Char_N");
+
+  CHK(Str_Str(p1, p2) == Ref_Str_Str(p1, p2), "Str_Str");
+  CHK(Str_Str_N(p1, p2, len_max) == Ref_Str_Str_N(p1, p2, len_max),
+      "Str_Str_N");
+
+  memset(Dest1, 0x5A, sizeof(Dest1));
+  memset(Dest2, 0x5A, sizeof(Dest2));
+  CHK(Str_Copy_N(d1, p1, len_max) - d1 == Ref_Str_Copy_N(d2, p1, len_max) - d2,
+      "Str_Copy_N");
+  CHK_DEST("Str_Copy_N");
+
+  CHK(Str_Copy(d1, p2) - d1 == Ref_Str_Copy(d2, p2) - d2, "Str_Copy");
+  CHK_DEST("Str_Copy");
+
+  CHK(Str_Cat_N(d1, p1, len_max) - d1 == Ref_Str_Cat_N(d2, p1, len_max) - d2,
+      "Str_Cat_N");
+  CHK_DEST("Str_Cat_N");
+
+  CHK(Str_Cat(d1, p1) - d1 == Ref_Str_Cat(d2, p1) - d2, "Str_Cat");
+  CHK_DEST("Str_Cat");
+}
+
+// Every length, alignment and word-boundary length limit; the second string
+// is a copy of the first, cut or changed at every position
+static void ExhaustiveRun(void)
+{
+  static const CPU_SIZE_T len_max_tbl[] = {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u,
+                                           15u, 16u, 17u, 33u, 64u,
+                                           DEF_INT_CPU_U_MAX_VAL};
+  CPU_CHAR *p1;
+  CPU_CHAR *p2;
+  int len;
+  int off1;
+  int off2;
+  int pos;
+  unsigned int i;
+
+  for (len = 0; len <= LEN_MAX; len++) {
+    for (off1 = 0; off1 < ALIGN_NBR; off1++) {
+      for (off2 = 0; off2 < ALIGN_NBR; off2++) {
+        p1 = (CPU_CHAR *)Buf1 + off1;
+        p2 = (CPU_CHAR *)Buf2 + off2;
+        StrFill(p1, len, 0);
+        for (i = 0; i < sizeof(len_max_tbl) / sizeof(len_max_tbl[0]); i++) {
+          memcpy(p2, p1, len + 1);                     // equal strings
+          CaseRun(p1, len, off1, p2, len, off2, len_max_tbl[i], p1[len / 2]);
+          for (pos = 0; pos < len; pos++) {
+            p2[pos] ^= (CPU_CHAR)0x80;                 // differ at 'pos' ...
+            CaseRun(p1, len, off1, p2, len, off2, len_max_tbl[i], p1[pos]);
+            p2[pos] = '\0';                            // ... end at 'pos'
+            CaseRun(p1, len, off1, p2, pos, off2, len_max_tbl[i], '\0');
+            p2[pos] = p1[pos];
+          }
+        }
+      }
+    }
+  }
+}
+
+static void RandomRun(void)
+{
+  CPU_CHAR *p1;
+  CPU_CHAR *p2;
+  CPU_SIZE_T len_max;
+  int len1;
+  int len2;
+  int off1;
+  int off2;
+  int alpha;
+  int n;
+
+  for (n = 0; n < RAND_NBR; n++) {
+    off1 = RandGet() % ALIGN_NBR;
+    off2 = RandGet() % ALIGN_NBR;
+    len1 = RandGet() % (LEN_MAX + 1);
+    alpha = (n & 1) ? 3 : 0;
+    p1 = (CPU_CHAR *)Buf1 + off1;
+    p2 = (CPU_CHAR *)Buf2 + off2;
+    StrFill(p1, len1, alpha);
+    if (RandGet() % 2u) {                              // mostly a prefix ...
+      len2 = RandGet() % (len1 + 1);
+      memcpy(p2, p1, len2);
+      p2[len2] = '\0';
+    } else {                                           // ... or unrelated
+      len2 = RandGet() % (LEN_MAX + 1);
+      StrFill(p2, len2, alpha);
+    }
+    len_max = (RandGet() % 8u == 0u) ? DEF_INT_CPU_U_MAX_VAL
+                                     : RandGet() % (LEN_MAX + 8);
+    CaseRun(p1, len1, off1, p2, len2, off2, len_max,
+            (CPU_CHAR)(alpha ? 'a' + RandGet() % 4u : RandGet() % 256u));
+  }
+}
+
+static double NsPerCall(clock_t start)
+{
+  return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / BENCH_CALLS;
+}
+
+// Word access vs octet-at-a-time, in ns per call, on strings of a few sizes
+static void BenchRun(void)
+{
+  static const int len_tbl[] = {4, 16, 64, 256, 1024};
+  static CPU_CHAR str1[1024 + 8];
+  static CPU_CHAR str2[1024 + 8];
+  static CPU_CHAR dest[1024 + 8];
+  volatile CPU_SIZE_T sink = 0u;
+  clock_t start;
+  unsigned int i;
+  int n;
+
+  printf("\n%-10s %6s %10s %10s\n", "function", "len", "ref [ns]", "word [ns]");
+  for (i = 0; i < sizeof(len_tbl) / sizeof(len_tbl[0]); i++) {
+    memset(str1, 'a', len_tbl[i]);
+    str1[len_tbl[i]] = '\0';
+    memcpy(str2, str1, len_tbl[i] + 1);
+
+#define BENCH(name, ref_call, word_call)                                      \
+  do {                                                                        \
+    double ns_ref;                                                            \
+    start = clock();                                                          \
+    for (n = 0; n < BENCH_CALLS; n++) {                                       \
+      sink += (CPU_SIZE_T)(size_t)(ref_call);                                 \
+    }                                                                         \
+    ns_ref = NsPerCall(start);                                                \
+    start = clock();                                                          \
+    for (n = 0; n < BENCH_CALLS; n++) {                                       \
+      sink += (CPU_SIZE_T)(size_t)(word_call);                                \
+    }                                                                         \
+    printf("%-10s %6d %10.1f %10.1f\n", name, len_tbl[i], ns_ref,             \
+           NsPerCall(start));                                                 \
+  } while (0)
+
+    BENCH("Str_Len", Ref_Str_Len(str1), Str_Len(str1));
+    BENCH("Str_Copy", Ref_Str_Copy(dest, str1), Str_Copy(dest, str1));
+    BENCH("Str_Cmp", Ref_Str_Cmp(str1, str2), Str_Cmp(str1, str2));
+    BENCH("Str_Char", Ref_Str_Char(str1, 'b'), Str_Char(str1, 'b'));
+  }
+  (void)sink;
+}
+
+/**********************************************************************  MAIN */
+int main(void)
+{
+  ExhaustiveRun();
+  RandomRun();
+  printf("lib_str_test: %lu cases, %lu failures\n", CaseCtr, FailCtr);
+
+  if (FailCtr == 0u) {
+    BenchRun();
+  }
+  return (FailCtr == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/** EOF */
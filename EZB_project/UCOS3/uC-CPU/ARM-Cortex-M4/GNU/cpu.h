@@ -298,6 +298,12 @@ typedef  CPU_ADDR                 CPU_STK_SIZE;                 /* Defines CPU s
 *
 *               (b) Configure 'CPU_SR' data type with the appropriate-sized CPU data type large enough to
 *                   completely store the CPU's/compiler's status word.
+*
+*           (4) (a) If CPU_CFG_KA_IPL_BOUNDARY is > 0, 'cpu_sr' holds BASEPRI and critical sections only
+*                   mask the interrupts at or below the kernel aware boundary (see 'cpu_cfg.h').
+*
+*               (b) If CPU_CFG_KA_IPL_CHK_EN is enabled, entering a critical section from an interrupt
+*                   above the boundary traps in CPU_KA_IPL_Chk().
 *********************************************************************************************************
 */
                                                                 /* Configure CPU critical method      (see Note #1) :   */
@@ -314,7 +320,16 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 
 
 
-#define  CPU_INT_DIS()         do { cpu_sr = CPU_SR_Save(); } while (0) /* Save    CPU status word & disable interrupts.*/
+#define  CPU_CFG_KA_BASEPRI    (CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS))    /* See Note #4a.  */
+
+#if     (CPU_CFG_KA_IPL_BOUNDARY > 0) && (CPU_CFG_KA_IPL_CHK_EN == DEF_ENABLED)
+#define  CPU_KA_IPL_CHK()      CPU_KA_IPL_Chk()                         /* See Note #4b.                                */
+#else
+#define  CPU_KA_IPL_CHK()
+#endif
+
+#define  CPU_INT_DIS()         do { CPU_KA_IPL_CHK();          \
+                                    cpu_sr = CPU_SR_Save(); } while (0) /* Save    CPU status word & disable interrupts.*/
 #define  CPU_INT_EN()          do { CPU_SR_Restore(cpu_sr); } while (0) /* Restore CPU status word.                     */
 
 
@@ -405,6 +420,10 @@ void        CPU_IntSrcPrioSet(CPU_INT08U  pos,
 CPU_SR      CPU_SR_Save      (void);
 void        CPU_SR_Restore   (CPU_SR      cpu_sr);
 
+#if     (CPU_CFG_KA_IPL_BOUNDARY > 0) && (CPU_CFG_KA_IPL_CHK_EN == DEF_ENABLED)
+void        CPU_KA_IPL_Chk   (void);
+#endif
+
 
 void        CPU_WaitForInt   (void);
 void        CPU_WaitForExcept(void);
@@ -531,6 +550,7 @@ void        CPU_BitBandSet   (CPU_ADDR    addr,
 #define  CPU_REG_NVIC_ICSR_ISRPREEMPT             0x00800000
 #define  CPU_REG_NVIC_ICSR_ISRPENDING             0x00400000
 #define  CPU_REG_NVIC_ICSR_RETTOBASE              0x00000800
+#define  CPU_REG_NVIC_ICSR_VECTACTIVE             0x000001FF
 
                                                                 /* ------------- VECT TBL OFFSET REG BITS ------------- */
 #define  CPU_REG_NVIC_VTOR_TBLBASE                0x20000000
@@ -601,6 +621,20 @@ void        CPU_BitBandSet   (CPU_ADDR    addr,
 #define  CPU_REG_NVIC_DFSR_BKPT                   0x00000002
 #define  CPU_REG_NVIC_DFSR_HALTED                 0x00000001
 
+                                                                /* ---------------- MPU CTRL REG BITS ----------------- */
+#define  CPU_REG_MPU_CTRL_PRIVDEFENA              0x00000004
+#define  CPU_REG_MPU_CTRL_HFNMIENA                0x00000002
+#define  CPU_REG_MPU_CTRL_ENABLE                  0x00000001
+
+                                                                /* ------------ MPU REGION BASE ADDR REG BITS --------- */
+#define  CPU_REG_MPU_RBAR_VALID                   0x00000010
+
+                                                                /* --------- MPU REGION ATTRIB & SIZE REG BITS -------- */
+#define  CPU_REG_MPU_RASR_XN                      0x10000000
+#define  CPU_REG_MPU_RASR_AP_NONE                 0x00000000
+#define  CPU_REG_MPU_RASR_SIZE_32B                0x00000008
+#define  CPU_REG_MPU_RASR_ENABLE                  0x00000001
+
 
 /*
 *********************************************************************************************************
@@ -713,6 +747,23 @@ void        CPU_BitBandSet   (CPU_ADDR    addr,
 
 
 
+#ifndef  CPU_CFG_KA_IPL_BOUNDARY
+#error  "CPU_CFG_KA_IPL_BOUNDARY        not #define'd in 'cpu_cfg.h'"
+#error  "                         [MUST be  0 (PRIMASK critical sections)      ]"
+#error  "                         [     ||  1 .. 2^CPU_CFG_NVIC_PRIO_BITS - 1  ]"
+
+#elif  ((CPU_CFG_KA_IPL_BOUNDARY > 0) && (!defined(CPU_CFG_NVIC_PRIO_BITS) || \
+                                          !defined(CPU_CFG_KA_IPL_CHK_EN)))
+#error  "CPU_CFG_NVIC_PRIO_BITS/CPU_CFG_KA_IPL_CHK_EN not #define'd in 'cpu_cfg.h'"
+
+#elif   (CPU_CFG_KA_IPL_BOUNDARY > 0) && (CPU_CFG_KA_IPL_BOUNDARY >= (1 << CPU_CFG_NVIC_PRIO_BITS))
+#error  "CPU_CFG_KA_IPL_BOUNDARY  illegally #define'd in 'cpu_cfg.h'"
+#error  "                         [MUST be  < 2^CPU_CFG_NVIC_PRIO_BITS         ]"
+#endif
+
+
+
+
 #ifndef  CPU_CFG_CRITICAL_METHOD
 #error  "CPU_CFG_CRITICAL_METHOD        not #define'd in 'cpu.h'             "
 #error  "                         [MUST be  CPU_CRITICAL_METHOD_INT_DIS_EN  ]"
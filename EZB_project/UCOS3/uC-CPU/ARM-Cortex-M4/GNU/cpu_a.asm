@@ -32,6 +32,13 @@
 @********************************************************************************************************
 
 
+@********************************************************************************************************
+@                                           INCLUDE FILES
+@********************************************************************************************************
+
+#include  <cpu_cfg.h>
+
+
 @********************************************************************************************************
 @                                           PUBLIC FUNCTIONS
 @********************************************************************************************************
@@ -104,8 +111,25 @@ CPU_IntEn:
 @                           CPU_CRITICAL_EXIT();                /* CPU_SR_Restore(cpu_sr);                  */
 @                               :
 @                       }
+@
+@               (2) If CPU_CFG_KA_IPL_BOUNDARY is > 0, 'cpu_sr' holds BASEPRI instead of PRIMASK.
+@                   BASEPRI_MAX only ever raises the mask, so nested critical sections never unmask
+@                   interrupts & the interrupts above the boundary are never masked.
 @********************************************************************************************************
 
+#if (CPU_CFG_KA_IPL_BOUNDARY > 0)
+.thumb_func
+CPU_SR_Save:
+        MRS     R0, BASEPRI                     @ Mask kernel aware ints only (see Note #2)
+        MOV     R1, #(CPU_CFG_KA_IPL_BOUNDARY << (8 - CPU_CFG_NVIC_PRIO_BITS))
+        MSR     BASEPRI_MAX, R1
+        BX      LR
+
+.thumb_func
+CPU_SR_Restore:                                  @ See Note #2.
+        MSR     BASEPRI, R0
+        BX      LR
+#else
 .thumb_func
 CPU_SR_Save:
         MRS     R0, PRIMASK                     @ Set prio int mask to mask all (except faults)
@@ -116,6 +140,7 @@ CPU_SR_Save:
 CPU_SR_Restore:                                  @ See Note #2.
         MSR     PRIMASK, R0
         BX      LR
+#endif
 
 
 @********************************************************************************************************
@@ -743,6 +743,58 @@ CPU_INT16S  CPU_IntSrcPrioGet (CPU_INT08U  pos)
     return (prio);
 }
 
+
+/*
+*********************************************************************************************************
+*                                          CPU_KA_IPL_Chk()
+*
+* Description : Trap a critical section entered from an interrupt above the kernel aware boundary.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+* Note(s)     : (1) Interrupts with a priority above CPU_CFG_KA_IPL_BOUNDARY are not masked by critical
+*                   sections (see 'cpu.h  CRITICAL SECTION CONFIGURATION  Note #4'), so they MUST NOT use
+*                   any service protected by one.
+*
+*               (2) The priority registers are read directly: CPU_IntSrcPrioGet() enters critical
+*                   sections itself.
+*
+*               (3) NMI & hard fault have fixed negative priorities & are always above the boundary.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_KA_IPL_BOUNDARY > 0) && (CPU_CFG_KA_IPL_CHK_EN == DEF_ENABLED)
+void  CPU_KA_IPL_Chk (void)
+{
+    CPU_INT32U  pos;
+    CPU_INT08U  prio;
+
+
+    pos = CPU_REG_NVIC_ICSR & CPU_REG_NVIC_ICSR_VECTACTIVE;
+    if (pos == 0u) {                                            /* Thread mode: nothing to check.                       */
+        return;
+    }
+
+    if (pos < CPU_INT_MEM) {                                    /* NMI or hard fault (see Note #3).                     */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (pos < CPU_INT_EXT0) {                                   /* System handler priority byte ...                     */
+        prio = *((CPU_REG08 *)(0xE000ED18 + (pos - CPU_INT_MEM)));
+    } else {                                                    /* ... or external interrupt priority byte.             */
+        prio = *((CPU_REG08 *)(0xE000E400 + (pos - CPU_INT_EXT0)));
+    }
+
+    if (prio < CPU_CFG_KA_BASEPRI) {                            /* Above the boundary (see Note #1).                    */
+        CPU_SW_EXCEPTION(;);
+    }
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -72,6 +72,38 @@
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+#define  MEM_TLSF_BLK_HDR_SIZE          (2u * sizeof(MEM_TLSF_BLK *))   /* Hdr fields in use by alloc'd blks.   */
+#define  MEM_TLSF_BLK_SIZE_MIN           MEM_TLSF_BLK_HDR_SIZE          /* Room for free list links.            */
+#define  MEM_TLSF_BLK_SIZE_MAX          (((CPU_SIZE_T)1u << LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2) - LIB_MEM_TLSF_ALIGN)
+#define  MEM_TLSF_BLK_FREE               DEF_BIT_00
+
+#define  MEM_TLSF_BLK_SIZE_GET(p_blk)   ((p_blk)->Size & ~(CPU_SIZE_T)MEM_TLSF_BLK_FREE)
+#define  MEM_TLSF_BLK_IS_FREE(p_blk)    (((p_blk)->Size &  (CPU_SIZE_T)MEM_TLSF_BLK_FREE) != 0u)
+#define  MEM_TLSF_BLK_TO_PTR(p_blk)     ((void *)((CPU_INT08U *)(p_blk) + MEM_TLSF_BLK_HDR_SIZE))
+#define  MEM_TLSF_PTR_TO_BLK(p_mem)     ((MEM_TLSF_BLK *)((CPU_INT08U *)(p_mem) - MEM_TLSF_BLK_HDR_SIZE))
+#define  MEM_TLSF_BLK_NEXT(p_blk)       ((MEM_TLSF_BLK *)((CPU_INT08U *)(p_blk) + MEM_TLSF_BLK_HDR_SIZE + MEM_TLSF_BLK_SIZE_GET(p_blk)))
+                                                                /* Ix of most significant bit set.                      */
+#define  MEM_TLSF_FLS(val)              ((CPU_DATA)((CPU_CFG_DATA_SIZE * DEF_OCTET_NBR_BITS) - 1u) - CPU_CntLeadZeros((CPU_DATA)(val)))
+
+                                                                /* Use app lock if set, else a critical section.        */
+#define  MEM_TLSF_LOCK(p_heap)           do {                                               \
+                                             if ((p_heap)->LockFnct != DEF_NULL) {          \
+                                                 (p_heap)->LockFnct((p_heap)->LockArgPtr);  \
+                                             } else {                                       \
+                                                 CPU_CRITICAL_ENTER();                      \
+                                             }                                              \
+                                         } while (0)
+
+#define  MEM_TLSF_UNLOCK(p_heap)         do {                                               \
+                                             if ((p_heap)->LockFnct != DEF_NULL) {          \
+                                                 (p_heap)->UnlockFnct((p_heap)->LockArgPtr);\
+                                             } else {                                       \
+                                                 CPU_CRITICAL_EXIT();                       \
+                                             }                                              \
+                                         } while (0)
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -111,6 +143,11 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if ((LIB_MEM_CFG_TLSF_EN     == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+MEM_TLSF    *Mem_TLSF_HeadPtr;                                  /* Ptr to head of TLSF heap list.                       */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -166,6 +203,21 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
                                                        void          *p_mem);
 #endif
 
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void          Mem_TLSF_MapGet          (       CPU_SIZE_T     size,
+                                                       CPU_DATA      *p_fl,
+                                                       CPU_DATA      *p_sl);
+
+static  void          Mem_TLSF_BlkInsert       (       MEM_TLSF      *p_heap,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  void          Mem_TLSF_BlkRemove       (       MEM_TLSF      *p_heap,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  MEM_TLSF_BLK *Mem_TLSF_BlkFind         (       MEM_TLSF      *p_heap,
+                                                       CPU_SIZE_T     size);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -2115,39 +2167,53 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                          Mem_TLSF_Create()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Creates a Two-Level Segregated Fit (TLSF) heap, carving its storage from a memory segment.
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_name  Pointer to heap name. Used for allocations tracking. May be DEF_NULL.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               p_heap  Pointer to heap data.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               p_seg   Pointer to segment from which to allocate the heap storage. Will be allocated from
+*                       general-purpose heap if DEF_NULL.
 *
-*                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*               size    Size of heap storage, in octets, including block headers (see Note #1).
 *
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
-*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : None.
+*                           LIB_MEM_ERR_NONE                    Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE        Invalid heap size specified.
+*
+*                           ----------------------RETURNED BY Mem_SegAllocInternal()-----------------------
+*                           LIB_MEM_ERR_INVALID_MEM_ALIGN       Invalid memory block alignment requested.
+*                           LIB_MEM_ERR_NULL_PTR                Error or segment data pointer NULL.
+*                           LIB_MEM_ERR_SEG_OVF                 Allocation would overflow memory segment.
+*
+* Return(s)   : none.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) 'size' is rounded down to a multiple of LIB_MEM_TLSF_ALIGN.  Two block headers are used
+*                   by the heap itself; the remaining storage must not exceed 2^LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TLSF_Create (const  CPU_CHAR    *p_name,
+                              MEM_TLSF    *p_heap,
+                              MEM_SEG     *p_seg,
+                              CPU_SIZE_T   size,
+                              LIB_ERR     *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
+    CPU_INT08U    *p_addr;
+    MEM_TLSF_BLK  *p_blk;
+    CPU_DATA       fl;
+    CPU_DATA       sl;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2155,79 +2221,67 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
         CPU_SW_EXCEPTION(;);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
 #endif
 
-    out_fnct("---------------- Memory allocation info ----------------\r\n");
-    out_fnct("| Type    | Size       | Free size  | Name\r\n");
-    out_fnct("|---------|------------|------------|-------------------\r\n");
-
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
+    size &= ~((CPU_SIZE_T)LIB_MEM_TLSF_ALIGN - 1u);             /* See Note #1.                                         */
+    if ((size                              < (2u * MEM_TLSF_BLK_HDR_SIZE) + MEM_TLSF_BLK_SIZE_MIN) ||
+        (size - (2u * MEM_TLSF_BLK_HDR_SIZE) > MEM_TLSF_BLK_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return;
+    }
 
+    p_addr = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
+                                                 p_seg,
+                                                 size,
+                                                 LIB_MEM_TLSF_ALIGN,
+                                                 LIB_MEM_PADDING_ALIGN_NONE,
+                                                 DEF_NULL,
+                                                 p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
 
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
-        if (*p_err != LIB_MEM_ERR_NONE) {
-            return;
+    for (fl = 0u; fl < LIB_MEM_TLSF_FL_NBR; fl++) {             /* Empty all free lists.                                */
+        for (sl = 0u; sl < LIB_MEM_TLSF_SL_NBR; sl++) {
+            p_heap->FreeTbl[fl][sl] = DEF_NULL;
         }
+        p_heap->SlBitmap[fl] = 0u;
+    }
+    p_heap->FlBitmap = 0u;
 
-        out_fnct("| Section | ");
-
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct(" | ");
-
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct(" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct("\r\n");
-
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct("| -> Obj  | ");
+    p_blk              = (MEM_TLSF_BLK *)p_addr;                /* One free blk spans the whole heap ...                */
+    p_blk->PrevPhysPtr =  DEF_NULL;
+    p_blk->Size        =  size - (2u * MEM_TLSF_BLK_HDR_SIZE);
 
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
+    p_heap->BlkFirstPtr             = p_blk;                    /* ... followed by the sentinel blk.                    */
+    p_heap->BlkEndPtr               = MEM_TLSF_BLK_NEXT(p_blk);
+    p_heap->BlkEndPtr->PrevPhysPtr  = p_blk;
+    p_heap->BlkEndPtr->Size         = 0u;
 
-            out_fnct(str);
-            out_fnct(" |            | ");
+    p_heap->TotalSize    = size;
+    p_heap->FreeSize     = 0u;
+    p_heap->FreeBlkCnt   = 0u;
+    p_heap->UsedBlkCnt   = 0u;
+    p_heap->AllocFailCtr = 0u;
+    p_heap->LockFnct     = DEF_NULL;
+    p_heap->UnlockFnct   = DEF_NULL;
+    p_heap->LockArgPtr   = DEF_NULL;
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct("\r\n");
+    Mem_TLSF_BlkInsert(p_heap, p_blk);
+    p_heap->FreeSizeMin  = p_heap->FreeSize;
 
-            p_alloc = p_alloc->NextPtr;
-        }
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_heap->NamePtr = p_name;
 
-        p_seg = p_seg->NextPtr;
-    }
+    CPU_CRITICAL_ENTER();
+    p_heap->NextPtr  = Mem_TLSF_HeadPtr;
+    Mem_TLSF_HeadPtr = p_heap;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2236,153 +2290,934 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                       Mem_SegCreateCritical()
+*                                          Mem_TLSF_LockSet()
 *
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+* Description : Sets the functions used to lock the heap around each operation.
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Argument(s) : p_heap          Pointer to heap data.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+*               lock_fnct       Pointer to lock   function (e.g. RTOS mutex pend). DEF_NULL to use critical
+*                               sections (see Note #1).
 *
-*               seg_base_addr   Segment's first byte address.
+*               unlock_fnct     Pointer to unlock function (e.g. RTOS mutex post).
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*               p_arg           Argument passed to 'lock_fnct' & 'unlock_fnct'.
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : Pointer to segment data, if successful.
+*                                   LIB_MEM_ERR_NONE        Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR    Heap data pointer NULL or only one of
+*                                                           'lock_fnct' & 'unlock_fnct' passed NULL.
 *
-*               DEF_NULL, otherwise.
+* Return(s)   : none.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) By default, each heap operation runs in a critical section.  Since allocation & release
+*                   are bounded, this is adequate for most systems & allows use from ISRs.  A heap with a
+*                   lock function set MUST NOT be used from ISRs.
+*
+*               (2) The lock functions MUST be set before the heap is shared between tasks.
 *********************************************************************************************************
 */
 
-static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
-                                           MEM_SEG     *p_seg,
-                                           CPU_ADDR     seg_base_addr,
-                                           CPU_SIZE_T   padding_align,
-                                           CPU_SIZE_T   size)
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TLSF_LockSet (MEM_TLSF   *p_heap,
+                        void      (*lock_fnct)  (void  *p_arg),
+                        void      (*unlock_fnct)(void  *p_arg),
+                        void       *p_arg,
+                        LIB_ERR    *p_err)
 {
-    p_seg->AddrBase         =  seg_base_addr;
-    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
-    p_seg->AddrNext         =  seg_base_addr;
-    p_seg->NextPtr          =  Mem_SegHeadPtr;
-    p_seg->PaddingAlign     =  padding_align;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_seg->NamePtr          = p_name;
-    p_seg->AllocInfoHeadPtr = DEF_NULL;
-#else
-    (void)&p_name;
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if ((lock_fnct == DEF_NULL) != (unlock_fnct == DEF_NULL)) { /* Chk that both or none lock fncts are set.            */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
 #endif
 
-    Mem_SegHeadPtr = p_seg;
+    p_heap->LockArgPtr = p_arg;
+    p_heap->UnlockFnct = unlock_fnct;
+    p_heap->LockFnct   = lock_fnct;
+
+   *p_err = LIB_MEM_ERR_NONE;
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                      Mem_SegOverlapChkCritical()
+*                                           Mem_TLSF_Alloc()
 *
-* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+* Description : Allocates a memory block from a TLSF heap.
 *
-* Argument(s) : seg_base_addr   Address of first byte of memory area.
+* Argument(s) : p_heap  Pointer to heap data.
 *
-*               size            Size of memory area, in bytes.
+*               size    Size of memory block to allocate, in octets.
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
-*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                           LIB_MEM_ERR_HEAP_OVF            No free block large enough.
 *
-* Return(s)   : Pointer to memory segment that overlaps.
+* Return(s)   : Pointer to memory block, if successful.
 *
 *               DEF_NULL, otherwise.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application.
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) The memory block returned is aligned on LIB_MEM_TLSF_ALIGN octets.
+*
+*               (2) The search rounds 'size' up to the next free list size, so a free block is taken from
+*                   the first non-empty list without walking it (good fit).  A free block between 'size' &
+*                   that rounded size may thus be missed when it is the only one large enough.
 *********************************************************************************************************
 */
 
-static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
-                                             CPU_SIZE_T   size,
-                                             LIB_ERR     *p_err)
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  *Mem_TLSF_Alloc (MEM_TLSF    *p_heap,
+                       CPU_SIZE_T   size,
+                       LIB_ERR     *p_err)
 {
-    MEM_SEG   *p_seg_chk;
-    CPU_ADDR   seg_new_end;
-    CPU_ADDR   seg_chk_start;
-    CPU_ADDR   seg_chk_end;
+    MEM_TLSF_BLK  *p_blk;
+    MEM_TLSF_BLK  *p_rem;
+    CPU_SIZE_T     blk_size;
+    CPU_SR_ALLOC();
 
 
-    seg_new_end = seg_base_addr + (size - 1u);
-    p_seg_chk   = Mem_SegHeadPtr;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
 
-    while (p_seg_chk != DEF_NULL) {
-        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
-        seg_chk_end   = (CPU_ADDR)p_seg_chk->AddrEnd;
+    if (p_heap == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
 
-        if ((seg_base_addr == seg_chk_start) && (seg_new_end == seg_chk_end)) {
-           *p_err = LIB_MEM_ERR_INVALID_SEG_EXISTS;
-            return (p_seg_chk);
-        } else if (((seg_base_addr >= seg_chk_start) && (seg_base_addr <= seg_chk_end)) ||
-                   ((seg_base_addr <= seg_chk_start) && (seg_new_end   >= seg_chk_start))) {
-           *p_err = LIB_MEM_ERR_INVALID_SEG_OVERLAP;
-            return (p_seg_chk);
+    if (size < 1u) {                                            /* Chk for invalid sized mem req.                       */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (size <= MEM_TLSF_BLK_SIZE_MAX) {
+        size = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_TLSF_ALIGN);
+        if (size < MEM_TLSF_BLK_SIZE_MIN) {
+            size = MEM_TLSF_BLK_SIZE_MIN;
         }
+    }
 
-        p_seg_chk = p_seg_chk->NextPtr;
+    MEM_TLSF_LOCK(p_heap);
+    p_blk = (size <= MEM_TLSF_BLK_SIZE_MAX) ? Mem_TLSF_BlkFind(p_heap, size) : DEF_NULL;
+    if (p_blk == DEF_NULL) {
+        p_heap->AllocFailCtr++;
+        MEM_TLSF_UNLOCK(p_heap);
+
+       *p_err = LIB_MEM_ERR_HEAP_OVF;
+        return (DEF_NULL);
+    }
+
+    Mem_TLSF_BlkRemove(p_heap, p_blk);
+
+    blk_size = MEM_TLSF_BLK_SIZE_GET(p_blk);                    /* Split blk if the rem can hold a free blk.            */
+    if (blk_size >= size + MEM_TLSF_BLK_HDR_SIZE + MEM_TLSF_BLK_SIZE_MIN) {
+        p_rem              = (MEM_TLSF_BLK *)((CPU_INT08U *)MEM_TLSF_BLK_TO_PTR(p_blk) + size);
+        p_rem->PrevPhysPtr =  p_blk;
+        p_rem->Size        =  blk_size - size - MEM_TLSF_BLK_HDR_SIZE;
+        MEM_TLSF_BLK_NEXT(p_rem)->PrevPhysPtr = p_rem;
+        p_blk->Size        =  size;
+
+        Mem_TLSF_BlkInsert(p_heap, p_rem);
+    }
+
+    p_heap->UsedBlkCnt++;
+    if (p_heap->FreeSize < p_heap->FreeSizeMin) {
+        p_heap->FreeSizeMin = p_heap->FreeSize;
     }
+    MEM_TLSF_UNLOCK(p_heap);
 
    *p_err = LIB_MEM_ERR_NONE;
 
-    return (DEF_NULL);
+    return (MEM_TLSF_BLK_TO_PTR(p_blk));
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                       Mem_SegAllocInternal()
-*
-* Description : Allocates memory from specified segment.
+*                                           Mem_TLSF_Free()
 *
-* Argument(s) : p_name  Pointer to allocated object name. Used for allocations tracking. May be DEF_NULL.
+* Description : Frees a memory block, merging it with its free physical neighbours.
 *
-*               p_seg           Pointer to segment from which to allocate memory.
+* Argument(s) : p_heap  Pointer to heap data.
 *
-*               size            Size of memory block to allocate, in bytes.
+*               p_blk   Pointer to memory block returned by Mem_TLSF_Alloc().
 *
-*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
-*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
-*                               means no padding.
+*                           LIB_MEM_ERR_NONE                        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                    'p_heap' or 'p_blk' pointer passed is NULL.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR            Block does not belong to heap.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Block already free.
 *
-*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
-*                                the allocation to succeed. Set to DEF_NULL to skip calculation.
+* Return(s)   : none.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+* Caller(s)   : Application.
 *
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
-*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+* Note(s)     : (1) The header of a blk absorbed by a merge is left in the merged blk's data area flagged as
+*                   free, so that a later double free of that blk is still caught by the chk below instead
+*                   of corrupting the heap.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TLSF_Free (MEM_TLSF  *p_heap,
+                     void      *p_blk,
+                     LIB_ERR   *p_err)
+{
+    MEM_TLSF_BLK  *p_tlsf_blk;
+    MEM_TLSF_BLK  *p_neighbour;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_heap == DEF_NULL) ||                                 /* Chk for NULL heap data or blk ptr.                   */
+        (p_blk  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (((CPU_INT08U *)p_blk <  (CPU_INT08U *)MEM_TLSF_BLK_TO_PTR(p_heap->BlkFirstPtr)) ||
+        ((CPU_INT08U *)p_blk >= (CPU_INT08U *)p_heap->BlkEndPtr)                       ||
+        (((CPU_INT08U *)p_blk - (CPU_INT08U *)p_heap->BlkFirstPtr) % LIB_MEM_TLSF_ALIGN != 0u)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+#endif
+
+    p_tlsf_blk = MEM_TLSF_PTR_TO_BLK(p_blk);
+
+    MEM_TLSF_LOCK(p_heap);
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (MEM_TLSF_BLK_IS_FREE(p_tlsf_blk)) {                     /* Chk for double free.                                 */
+        MEM_TLSF_UNLOCK(p_heap);
+
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
+    }
+#endif
+
+    p_heap->UsedBlkCnt--;
+                                                                /* Merge with prev blk if free ...                      */
+    p_neighbour = p_tlsf_blk->PrevPhysPtr;
+    if ((p_neighbour != DEF_NULL) &&
+        (MEM_TLSF_BLK_IS_FREE(p_neighbour))) {
+        Mem_TLSF_BlkRemove(p_heap, p_neighbour);
+        p_neighbour->Size += MEM_TLSF_BLK_HDR_SIZE + p_tlsf_blk->Size;
+        p_tlsf_blk->Size  |= MEM_TLSF_BLK_FREE;                 /* See Note #1.                                         */
+        p_tlsf_blk         = p_neighbour;
+    }
+                                                                /* ... & with next blk if free (never the sentinel).    */
+    p_neighbour = MEM_TLSF_BLK_NEXT(p_tlsf_blk);
+    if (MEM_TLSF_BLK_IS_FREE(p_neighbour)) {
+        Mem_TLSF_BlkRemove(p_heap, p_neighbour);
+        p_tlsf_blk->Size  += MEM_TLSF_BLK_HDR_SIZE + p_neighbour->Size;
+        p_neighbour->Size |= MEM_TLSF_BLK_FREE;                 /* See Note #1.                                         */
+    }
+    MEM_TLSF_BLK_NEXT(p_tlsf_blk)->PrevPhysPtr = p_tlsf_blk;
+
+    Mem_TLSF_BlkInsert(p_heap, p_tlsf_blk);
+    MEM_TLSF_UNLOCK(p_heap);
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TLSF_InfoGet()
+*
+* Description : Gets usage & fragmentation statistics of a TLSF heap.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*
+*               p_info  Pointer to structure that will receive the heap statistics.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR    'p_heap' or 'p_info' pointer passed is NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               Mem_OutputUsage().
+*
+* Note(s)     : (1) The largest free block is found in the highest non-empty free list; only that list is
+*                   walked.
+*
+*               (2) Fragmentation is the percentage of free memory that lies outside the largest free
+*                   block, i.e. that a single allocation cannot use.  0% means all free memory is contiguous.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TLSF_InfoGet (MEM_TLSF       *p_heap,
+                        MEM_TLSF_INFO  *p_info,
+                        LIB_ERR        *p_err)
+{
+    MEM_TLSF_BLK  *p_blk;
+    CPU_SIZE_T     blk_size_max;
+    CPU_SIZE_T     frag_size;
+    CPU_DATA       fl;
+    CPU_DATA       sl;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_heap == DEF_NULL) ||                                 /* Chk for NULL heap data or info ptr.                  */
+        (p_info == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    MEM_TLSF_LOCK(p_heap);
+    blk_size_max = 0u;
+    if (p_heap->FlBitmap != 0u) {                               /* See Note #1.                                         */
+        fl    = MEM_TLSF_FLS(p_heap->FlBitmap);
+        sl    = MEM_TLSF_FLS(p_heap->SlBitmap[fl]);
+        p_blk = p_heap->FreeTbl[fl][sl];
+        while (p_blk != DEF_NULL) {
+            if (MEM_TLSF_BLK_SIZE_GET(p_blk) > blk_size_max) {
+                blk_size_max = MEM_TLSF_BLK_SIZE_GET(p_blk);
+            }
+            p_blk = p_blk->NextFreePtr;
+        }
+    }
+
+    p_info->TotalSize      = p_heap->TotalSize;
+    p_info->FreeSize       = p_heap->FreeSize;
+    p_info->FreeSizeMin    = p_heap->FreeSizeMin;
+    p_info->FreeBlkSizeMax = blk_size_max;
+    p_info->FreeBlkCnt     = p_heap->FreeBlkCnt;
+    p_info->UsedBlkCnt     = p_heap->UsedBlkCnt;
+    p_info->AllocFailCtr   = p_heap->AllocFailCtr;
+    MEM_TLSF_UNLOCK(p_heap);
+
+    frag_size = p_info->FreeSize - blk_size_max;                /* See Note #2.                                         */
+    if (frag_size == 0u) {
+        p_info->FragPct = 0u;
+    } else if (frag_size <= (DEF_INT_32U_MAX_VAL / 100u)) {
+        p_info->FragPct = (CPU_INT08U)((frag_size * 100u) / p_info->FreeSize);
+    } else {
+        p_info->FragPct = (CPU_INT08U)(frag_size / (p_info->FreeSize / 100u));
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_ArenaCreate()
+*
+* Description : Creates a memory arena, carving its buffer from a memory segment.
+*
+* Argument(s) : p_name      Pointer to arena name. Used for allocations tracking. May be DEF_NULL.
+*
+*               p_arena     Pointer to arena data.
+*
+*               p_seg       Pointer to segment from which to allocate the arena buffer. Will be allocated
+*                           from general-purpose heap if DEF_NULL.
+*
+*               size        Size of arena buffer, in octets.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Arena data pointer NULL.
+*
+*                               ----------------------RETURNED BY Mem_SegAllocInternal()-------------------
+*                               LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                               LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+void  Mem_ArenaCreate (const  CPU_CHAR    *p_name,
+                              MEM_ARENA   *p_arena,
+                              MEM_SEG     *p_seg,
+                              CPU_SIZE_T   size,
+                              LIB_ERR     *p_err)
+{
+    CPU_INT08U  *p_buf;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_arena == DEF_NULL) {                                  /* Chk for NULL arena data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    p_buf = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
+                                               p_seg,
+                                               size,
+                                               sizeof(CPU_ALIGN),
+                                               LIB_MEM_PADDING_ALIGN_NONE,
+                                               DEF_NULL,
+                                               p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+    p_arena->AddrBase    = p_buf;
+    p_arena->TotalSize   = size;
+    p_arena->UsedSize    = 0u;
+    p_arena->UsedSizeMax = 0u;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_arena->NamePtr     = p_name;
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_ArenaAlloc()
+*
+* Description : Allocates a memory block from a memory arena.
+*
+* Argument(s) : p_arena     Pointer to arena data.
+*
+*               size        Size of memory block to allocate, in octets.
+*
+*               align       Required alignment of memory block, in octets. MUST be a power of 2.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Arena data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow the arena.
+*
+* Return(s)   : Pointer to memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Memory blocks are NOT cleared.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+void  *Mem_ArenaAlloc (MEM_ARENA   *p_arena,
+                       CPU_SIZE_T   size,
+                       CPU_SIZE_T   align,
+                       LIB_ERR     *p_err)
+{
+    CPU_INT08U  *p_blk;
+    CPU_SIZE_T   padding;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_arena == DEF_NULL) {                                  /* Chk for NULL arena data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+
+    if (size < 1u) {                                            /* Chk for invalid sized mem req.                       */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    if (MATH_IS_PWR2(align) != DEF_YES) {                       /* Chk that align is a pwr of 2.                        */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_ALIGN;
+        return (DEF_NULL);
+    }
+#endif
+
+    p_blk   = p_arena->AddrBase + p_arena->UsedSize;
+    padding = (align - ((CPU_SIZE_T)(CPU_ADDR)p_blk & (align - 1u))) & (align - 1u);
+    if ((padding > p_arena->TotalSize - p_arena->UsedSize) ||
+        (size    > p_arena->TotalSize - p_arena->UsedSize - padding)) {
+       *p_err = LIB_MEM_ERR_SEG_OVF;
+        return (DEF_NULL);
+    }
+
+    p_blk             += padding;
+    p_arena->UsedSize += padding + size;
+    if (p_arena->UsedSize > p_arena->UsedSizeMax) {
+        p_arena->UsedSizeMax = p_arena->UsedSize;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return ((void *)p_blk);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_ArenaMark()
+*
+* Description : Gets a mark of the current arena usage, to be passed to Mem_ArenaResetToMark().
+*
+* Argument(s) : p_arena     Pointer to arena data.
+*
+* Return(s)   : Mark.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+MEM_ARENA_MARK  Mem_ArenaMark (MEM_ARENA  *p_arena)
+{
+    return ((MEM_ARENA_MARK)p_arena->UsedSize);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_ArenaResetToMark()
+*
+* Description : Releases all memory blocks allocated from an arena since a mark was taken.
+*
+* Argument(s) : p_arena     Pointer to arena data.
+*
+*               mark        Mark returned by Mem_ArenaMark(), or 0 to release the whole arena.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Arena data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Mark beyond current arena usage, i.e.
+*                                                               already released.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Marks taken after 'mark' become invalid.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+void  Mem_ArenaResetToMark (MEM_ARENA       *p_arena,
+                            MEM_ARENA_MARK   mark,
+                            LIB_ERR         *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_arena == DEF_NULL) {                                  /* Chk for NULL arena data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (mark > p_arena->UsedSize) {                             /* Chk for stale mark.                                  */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return;
+    }
+#endif
+
+    p_arena->UsedSize = (CPU_SIZE_T)mark;
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
+    MEM_SEG   *p_seg;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct("---------------- Memory allocation info ----------------\r\n");
+    out_fnct("| Type    | Size       | Free size  | Name\r\n");
+    out_fnct("|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct("| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct(" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct(" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct("\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct("| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct(" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct("\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+    {
+        MEM_TLSF       *p_heap;
+        MEM_TLSF_INFO   heap_info;
+
+
+        CPU_CRITICAL_ENTER();
+        p_heap = Mem_TLSF_HeadPtr;
+        CPU_CRITICAL_EXIT();
+        while (p_heap != DEF_NULL) {                            /* Heaps may use a lock fnct: report outside crit sect. */
+            Mem_TLSF_InfoGet(p_heap, &heap_info, p_err);
+            if (*p_err != LIB_MEM_ERR_NONE) {
+                return;
+            }
+
+            out_fnct("| TLSF    | ");
+            (void)Str_FmtNbr_Int32U(heap_info.TotalSize,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+            out_fnct(str);
+            out_fnct(" | ");
+            (void)Str_FmtNbr_Int32U(heap_info.FreeSize,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+            out_fnct(str);
+            out_fnct(" | ");
+            out_fnct((p_heap->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_heap->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct("\r\n");
+
+            out_fnct("| -> Frag | ");                           /* Largest free blk, lowest free size & frag pct.       */
+            (void)Str_FmtNbr_Int32U(heap_info.FreeBlkSizeMax,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+            out_fnct(str);
+            out_fnct(" | ");
+            (void)Str_FmtNbr_Int32U(heap_info.FreeSizeMin,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+            out_fnct(str);
+            out_fnct(" | ");
+            (void)Str_FmtNbr_Int32U(heap_info.FragPct,
+                                    3u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+            out_fnct(str);
+            out_fnct("% fragmented, largest blk / min free\r\n");
+
+            p_heap = p_heap->NextPtr;
+        }
+    }
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
+                                           MEM_SEG     *p_seg,
+                                           CPU_ADDR     seg_base_addr,
+                                           CPU_SIZE_T   padding_align,
+                                           CPU_SIZE_T   size)
+{
+    p_seg->AddrBase         =  seg_base_addr;
+    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
+    p_seg->AddrNext         =  seg_base_addr;
+    p_seg->NextPtr          =  Mem_SegHeadPtr;
+    p_seg->PaddingAlign     =  padding_align;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_seg->NamePtr          = p_name;
+    p_seg->AllocInfoHeadPtr = DEF_NULL;
+#else
+    (void)&p_name;
+#endif
+
+    Mem_SegHeadPtr = p_seg;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_SegOverlapChkCritical()
+*
+* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+*
+* Argument(s) : seg_base_addr   Address of first byte of memory area.
+*
+*               size            Size of memory area, in bytes.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
+*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*
+* Return(s)   : Pointer to memory segment that overlaps.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
+                                             CPU_SIZE_T   size,
+                                             LIB_ERR     *p_err)
+{
+    MEM_SEG   *p_seg_chk;
+    CPU_ADDR   seg_new_end;
+    CPU_ADDR   seg_chk_start;
+    CPU_ADDR   seg_chk_end;
+
+
+    seg_new_end = seg_base_addr + (size - 1u);
+    p_seg_chk   = Mem_SegHeadPtr;
+
+    while (p_seg_chk != DEF_NULL) {
+        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
+        seg_chk_end   = (CPU_ADDR)p_seg_chk->AddrEnd;
+
+        if ((seg_base_addr == seg_chk_start) && (seg_new_end == seg_chk_end)) {
+           *p_err = LIB_MEM_ERR_INVALID_SEG_EXISTS;
+            return (p_seg_chk);
+        } else if (((seg_base_addr >= seg_chk_start) && (seg_base_addr <= seg_chk_end)) ||
+                   ((seg_base_addr <= seg_chk_start) && (seg_new_end   >= seg_chk_start))) {
+           *p_err = LIB_MEM_ERR_INVALID_SEG_OVERLAP;
+            return (p_seg_chk);
+        }
+
+        p_seg_chk = p_seg_chk->NextPtr;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegAllocInternal()
+*
+* Description : Allocates memory from specified segment.
+*
+* Argument(s) : p_name  Pointer to allocated object name. Used for allocations tracking. May be DEF_NULL.
+*
+*               p_seg           Pointer to segment from which to allocate memory.
+*
+*               size            Size of memory block to allocate, in bytes.
+*
+*               align           Required alignment of memory block, in bytes. MUST be a power of 2.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer from
+*                               this memory segment. MUST be a power of 2. LIB_MEM_PADDING_ALIGN_NONE
+*                               means no padding.
+*
+*               p_bytes_reqd    Pointer to variable that will receive the number of free bytes missing for
+*                                the allocation to succeed. Set to DEF_NULL to skip calculation.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
 *                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
 *
 *                                   ------------------RETURNED BY Mem_SegAllocExtCritical()------------------
@@ -2798,3 +3633,205 @@ static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
     }
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TLSF_MapGet()
+*
+* Description : Gets the free list indexes matching a block size.
+*
+* Argument(s) : size    Block size, in octets.
+*
+*               p_fl    Pointer to variable that will receive the first-level  index.
+*
+*               p_sl    Pointer to variable that will receive the second-level index.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TLSF_BlkInsert(),
+*               Mem_TLSF_BlkRemove(),
+*               Mem_TLSF_BlkFind().
+*
+* Note(s)     : (1) Sizes below 2^LIB_MEM_TLSF_FL_SHIFT are spread linearly over the lists of first-level
+*                   class 0, one list per LIB_MEM_TLSF_ALIGN octets.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void  Mem_TLSF_MapGet (CPU_SIZE_T   size,
+                               CPU_DATA    *p_fl,
+                               CPU_DATA    *p_sl)
+{
+    CPU_DATA  fl;
+
+
+    if (size < ((CPU_SIZE_T)1u << LIB_MEM_TLSF_FL_SHIFT)) {     /* See Note #1.                                         */
+       *p_fl = 0u;
+       *p_sl = (CPU_DATA)(size >> LIB_MEM_TLSF_ALIGN_LOG2);
+    } else {
+        fl    =  MEM_TLSF_FLS(size);
+       *p_sl  = (CPU_DATA)(size >> (fl - LIB_MEM_TLSF_SL_NBR_LOG2)) - LIB_MEM_TLSF_SL_NBR;
+       *p_fl  =  fl - (LIB_MEM_TLSF_FL_SHIFT - 1u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TLSF_BlkInsert()
+*
+* Description : Marks a block free & inserts it at the head of its free list.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TLSF_Create(),
+*               Mem_TLSF_Alloc(),
+*               Mem_TLSF_Free().
+*
+* Note(s)     : (1) This function MUST be called with the heap locked.
+*********************************************************************************************************
+*/
+
+static  void  Mem_TLSF_BlkInsert (MEM_TLSF      *p_heap,
+                                  MEM_TLSF_BLK  *p_blk)
+{
+    MEM_TLSF_BLK  *p_head;
+    CPU_SIZE_T     size;
+    CPU_DATA       fl;
+    CPU_DATA       sl;
+
+
+    size = MEM_TLSF_BLK_SIZE_GET(p_blk);
+    Mem_TLSF_MapGet(size, &fl, &sl);
+
+    p_head             = p_heap->FreeTbl[fl][sl];
+    p_blk->NextFreePtr = p_head;
+    p_blk->PrevFreePtr = DEF_NULL;
+    if (p_head != DEF_NULL) {
+        p_head->PrevFreePtr = p_blk;
+    }
+    p_heap->FreeTbl[fl][sl] = p_blk;
+
+    DEF_BIT_SET(p_heap->FlBitmap,     DEF_BIT(fl));
+    DEF_BIT_SET(p_heap->SlBitmap[fl], DEF_BIT(sl));
+
+    p_blk->Size        |= MEM_TLSF_BLK_FREE;
+    p_heap->FreeSize   += size;
+    p_heap->FreeBlkCnt++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TLSF_BlkRemove()
+*
+* Description : Removes a free block from its free list & marks it allocated.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TLSF_Alloc(),
+*               Mem_TLSF_Free().
+*
+* Note(s)     : (1) This function MUST be called with the heap locked.
+*********************************************************************************************************
+*/
+
+static  void  Mem_TLSF_BlkRemove (MEM_TLSF      *p_heap,
+                                  MEM_TLSF_BLK  *p_blk)
+{
+    CPU_SIZE_T  size;
+    CPU_DATA    fl;
+    CPU_DATA    sl;
+
+
+    size = MEM_TLSF_BLK_SIZE_GET(p_blk);
+    Mem_TLSF_MapGet(size, &fl, &sl);
+
+    if (p_blk->NextFreePtr != DEF_NULL) {
+        p_blk->NextFreePtr->PrevFreePtr = p_blk->PrevFreePtr;
+    }
+    if (p_blk->PrevFreePtr != DEF_NULL) {
+        p_blk->PrevFreePtr->NextFreePtr = p_blk->NextFreePtr;
+    } else {                                                    /* Blk is list head.                                    */
+        p_heap->FreeTbl[fl][sl] = p_blk->NextFreePtr;
+        if (p_blk->NextFreePtr == DEF_NULL) {                   /* List now empty: upd bitmaps.                         */
+            DEF_BIT_CLR(p_heap->SlBitmap[fl], DEF_BIT(sl));
+            if (p_heap->SlBitmap[fl] == 0u) {
+                DEF_BIT_CLR(p_heap->FlBitmap, DEF_BIT(fl));
+            }
+        }
+    }
+
+    p_blk->Size        &= ~(CPU_SIZE_T)MEM_TLSF_BLK_FREE;
+    p_heap->FreeSize   -= size;
+    p_heap->FreeBlkCnt--;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_TLSF_BlkFind()
+*
+* Description : Finds a free block of at least the requested size.
+*
+* Argument(s) : p_heap  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               size    Requested size, in octets, aligned on LIB_MEM_TLSF_ALIGN.
+*
+* Return(s)   : Pointer to free block, if any.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_TLSF_Alloc().
+*
+* Note(s)     : (1) 'size' is rounded up to the lower bound of the next free list, so any block of the
+*                   first non-empty list found is large enough (see 'Mem_TLSF_Alloc()  Note #2').
+*
+*               (2) This function MUST be called with the heap locked.
+*********************************************************************************************************
+*/
+
+static  MEM_TLSF_BLK  *Mem_TLSF_BlkFind (MEM_TLSF    *p_heap,
+                                         CPU_SIZE_T   size)
+{
+    CPU_DATA  fl;
+    CPU_DATA  sl;
+    CPU_DATA  map;
+
+
+    if (size >= ((CPU_SIZE_T)1u << LIB_MEM_TLSF_FL_SHIFT)) {    /* See Note #1.                                         */
+        size += ((CPU_SIZE_T)1u << (MEM_TLSF_FLS(size) - LIB_MEM_TLSF_SL_NBR_LOG2)) - 1u;
+    }
+    Mem_TLSF_MapGet(size, &fl, &sl);
+    if (fl >= LIB_MEM_TLSF_FL_NBR) {
+        return (DEF_NULL);
+    }
+
+    map = p_heap->SlBitmap[fl] & (DEF_INT_CPU_U_MAX_VAL << sl); /* Non-empty lists of same class, at least as big ...   */
+    if (map == 0u) {                                            /* ... else first non-empty larger class.               */
+        map = p_heap->FlBitmap & (DEF_INT_CPU_U_MAX_VAL << (fl + 1u));
+        if (map == 0u) {
+            return (DEF_NULL);
+        }
+        fl  = CPU_CntTrailZeros(map);
+        map = p_heap->SlBitmap[fl];
+    }
+    sl = CPU_CntTrailZeros(map);
+
+    return (p_heap->FreeTbl[fl][sl]);
+}
+#endif
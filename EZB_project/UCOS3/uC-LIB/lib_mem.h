@@ -137,6 +137,15 @@
 
 #define  LIB_MEM_BLK_QTY_UNLIMITED                        0u
 
+                                                                /* ------------------ TLSF HEAP DEFS ------------------ */
+#define  LIB_MEM_TLSF_ALIGN_LOG2                          3u    /* Blks are 8-octet aligned & sized.                    */
+#define  LIB_MEM_TLSF_ALIGN                     (1u << LIB_MEM_TLSF_ALIGN_LOG2)
+#define  LIB_MEM_TLSF_SL_NBR_LOG2                         4u    /* 16 second-level lists per power of 2.                */
+#define  LIB_MEM_TLSF_SL_NBR                    (1u << LIB_MEM_TLSF_SL_NBR_LOG2)
+                                                                /* Blks smaller than 2^FL_SHIFT share first-level 0.    */
+#define  LIB_MEM_TLSF_FL_SHIFT                  (LIB_MEM_TLSF_SL_NBR_LOG2 + LIB_MEM_TLSF_ALIGN_LOG2)
+#define  LIB_MEM_TLSF_FL_NBR                    (LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 - LIB_MEM_TLSF_FL_SHIFT + 1u)
+
 
 /*
 *********************************************************************************************************
@@ -212,6 +221,42 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                      TLSF HEAP CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_TLSF_EN to enable/disable the Two-Level Segregated Fit (TLSF)
+*               heap, Mem_TLSF_xxx(), which allocates & frees variable-size blocks in bounded time.
+*
+*           (2) Configure LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 with the base-2 logarithm of the largest TLSF
+*               heap, in octets.  Each TLSF heap holds LIB_MEM_TLSF_SL_NBR free list pointers for each
+*               power of 2 between 2^LIB_MEM_TLSF_FL_SHIFT & 2^LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_TLSF_EN
+#define  LIB_MEM_CFG_TLSF_EN             DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2
+#define  LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2             16u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    MEMORY ARENA CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_ARENA_EN to enable/disable memory arenas, Mem_Arena_xxx(), i.e.
+*               bump allocators whose allocations are all released at once by resetting to a mark.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_ARENA_EN
+#define  LIB_MEM_CFG_ARENA_EN            DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -371,6 +416,122 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                        TLSF HEAP DATA TYPES
+*
+* Note(s) : (1) Each block is preceded by a header holding a pointer to the physically previous block
+*               & the block's size.  Free blocks are also linked in the free list matching their size,
+*               using the first octets of the (unused) block data area.
+*
+*               (a) Block sizes are multiples of LIB_MEM_TLSF_ALIGN; bit 0 of 'Size' flags a free block.
+*
+*               (b) The last block of a heap is a zero-size, allocated sentinel that stops coalescing.
+*
+*               BlkFirstPtr -->/--------------\ /--------------\ /-----\<-- BlkEndPtr (sentinel)
+*                              | Hdr |  Data  | | Hdr |  Data  | | Hdr |
+*                              \--------------/ \--------------/ \-----/
+*                               ^                 |  ^             |
+*                               \---PrevPhysPtr---/  \-PrevPhysPtr-/
+*
+*           (2) Free blocks are indexed by a two-level table :
+*
+*               (a) the first  level splits sizes in powers of 2;
+*               (b) the second level splits each power of 2 in LIB_MEM_TLSF_SL_NBR equal ranges.
+*
+*               Bitmaps of non-empty lists find a fitting free block with two bit scans, so allocation
+*               & release never search the heap.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+typedef  struct  mem_tlsf_blk  MEM_TLSF_BLK;
+
+struct  mem_tlsf_blk {                                          /* ------------------ TLSF BLK HDR ------------------- */
+    MEM_TLSF_BLK  *PrevPhysPtr;                                 /* Ptr to physically prev blk (DEF_NULL for first blk). */
+    CPU_SIZE_T     Size;                                        /* Data size, in octets (see Note #1a).                 */
+    MEM_TLSF_BLK  *NextFreePtr;                                 /* Free list links, valid only while blk is free ...    */
+    MEM_TLSF_BLK  *PrevFreePtr;                                 /* ... & stored in the blk data area (see Note #1).     */
+};
+
+
+typedef  struct  mem_tlsf  MEM_TLSF;
+
+struct  mem_tlsf {                                              /* --------------------- TLSF HEAP -------------------- */
+           MEM_TLSF_BLK   *FreeTbl[LIB_MEM_TLSF_FL_NBR][LIB_MEM_TLSF_SL_NBR]; /* Free lists (see Note #2).     */
+           CPU_DATA        FlBitmap;                            /* Non-empty first-level  classes.                      */
+           CPU_DATA        SlBitmap[LIB_MEM_TLSF_FL_NBR];       /* Non-empty second-level lists, per first-level class. */
+
+           MEM_TLSF_BLK   *BlkFirstPtr;                         /* Ptr to first blk.                                    */
+           MEM_TLSF_BLK   *BlkEndPtr;                           /* Ptr to sentinel blk.                                 */
+
+           CPU_SIZE_T      TotalSize;                           /* Heap size, in octets (incl. blk hdrs).               */
+           CPU_SIZE_T      FreeSize;                            /* Sum of free blk sizes, in octets.                    */
+           CPU_SIZE_T      FreeSizeMin;                         /* Lowest free size ever reached.                       */
+           CPU_SIZE_T      FreeBlkCnt;                          /* Nbr of free blks.                                    */
+           CPU_SIZE_T      UsedBlkCnt;                          /* Nbr of alloc'd  blks.                                */
+           CPU_SIZE_T      AllocFailCtr;                        /* Nbr of failed allocs.                                */
+
+           void          (*LockFnct)  (void  *p_arg);           /* Optional lock fnct (see Mem_TLSF_LockSet()).         */
+           void          (*UnlockFnct)(void  *p_arg);
+           void           *LockArgPtr;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR       *NamePtr;                             /* Ptr to heap name.                                    */
+           MEM_TLSF       *NextPtr;                             /* Ptr to next heap.                                    */
+#endif
+};
+
+
+typedef  struct  mem_tlsf_info {                                /* ------------------ TLSF HEAP INFO ------------------ */
+    CPU_SIZE_T  TotalSize;                                      /* Heap size, in octets.                                */
+    CPU_SIZE_T  FreeSize;                                       /* Sum of free blk sizes, in octets.                    */
+    CPU_SIZE_T  FreeSizeMin;                                    /* Lowest free size ever reached.                       */
+    CPU_SIZE_T  FreeBlkSizeMax;                                 /* Largest free blk, i.e. largest possible alloc.       */
+    CPU_SIZE_T  FreeBlkCnt;                                     /* Nbr of free blks.                                    */
+    CPU_SIZE_T  UsedBlkCnt;                                     /* Nbr of alloc'd  blks.                                */
+    CPU_SIZE_T  AllocFailCtr;                                   /* Nbr of failed allocs.                                */
+    CPU_INT08U  FragPct;                                        /* Pct of free size NOT in the largest free blk.        */
+} MEM_TLSF_INFO;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       MEMORY ARENA DATA TYPES
+*
+* Note(s) : (1) An arena is a buffer carved from a memory segment once & then allocated from by bumping
+*               an offset.  A mark is the offset at a given time; resetting to a mark releases, in one
+*               step, everything allocated since the mark was taken.
+*
+*                                  Mark            UsedSize
+*                                    |                 |
+*                         /----------v-----------------v-------------------\
+*              AddrBase-->|  (kept)  |  (released by    |      (free)       |
+*                         |          |   ResetToMark)   |                   |
+*                         \------------------------------------------------/
+*
+*           (2) Arenas are NOT protected against concurrent access & are meant to be owned by a single
+*               task, e.g. as per-request scratch memory.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+typedef  CPU_SIZE_T  MEM_ARENA_MARK;
+
+typedef  struct  mem_arena {                                    /* --------------------- MEM ARENA -------------------- */
+           CPU_INT08U  *AddrBase;                               /* Ptr to arena buf.                                    */
+           CPU_SIZE_T   TotalSize;                              /* Arena size, in octets.                               */
+           CPU_SIZE_T   UsedSize;                               /* Octets in use, i.e. offset of next alloc.            */
+           CPU_SIZE_T   UsedSizeMax;                            /* Peak octets in use.                                  */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR    *NamePtr;                                /* Ptr to arena name.                                   */
+#endif
+} MEM_ARENA;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1327,6 +1488,53 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+                                                                /* ----------------- TLSF HEAP FNCTS ------------------ */
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void               Mem_TLSF_Create          (const  CPU_CHAR          *p_name,
+                                                    MEM_TLSF          *p_heap,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_TLSF_LockSet         (       MEM_TLSF          *p_heap,
+                                                    void             (*lock_fnct)  (void  *p_arg),
+                                                    void             (*unlock_fnct)(void  *p_arg),
+                                                    void              *p_arg,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_TLSF_Alloc           (       MEM_TLSF          *p_heap,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_TLSF_Free            (       MEM_TLSF          *p_heap,
+                                                    void              *p_blk,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_TLSF_InfoGet         (       MEM_TLSF          *p_heap,
+                                                    MEM_TLSF_INFO     *p_info,
+                                                    LIB_ERR           *p_err);
+#endif
+
+                                                                /* ------------------ MEM ARENA FNCTS ----------------- */
+#if (LIB_MEM_CFG_ARENA_EN == DEF_ENABLED)
+void               Mem_ArenaCreate          (const  CPU_CHAR          *p_name,
+                                                    MEM_ARENA         *p_arena,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_ArenaAlloc           (       MEM_ARENA         *p_arena,
+                                                    CPU_SIZE_T         size,
+                                                    CPU_SIZE_T         align,
+                                                    LIB_ERR           *p_err);
+
+MEM_ARENA_MARK     Mem_ArenaMark            (       MEM_ARENA         *p_arena);
+
+void               Mem_ArenaResetToMark     (       MEM_ARENA         *p_arena,
+                                                    MEM_ARENA_MARK     mark,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1388,6 +1596,30 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_TLSF_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_TLSF_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_TLSF_EN illegally defined in 'lib_cfg.h'"
+#error  "                    [MUST be  DEF_DISABLED]         "
+#error  "                    [     ||  DEF_ENABLED ]         "
+
+#elif   (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+#if    ((LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 <= LIB_MEM_TLSF_FL_SHIFT) || \
+        (LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 >  31u))
+#error  "LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 illegally defined in 'lib_cfg.h'"
+#error  "                               [MUST be > LIB_MEM_TLSF_FL_SHIFT]"
+#error  "                               [     && <= 31                 ]"
+#endif
+#endif
+
+
+#if    ((LIB_MEM_CFG_ARENA_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_ARENA_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_ARENA_EN illegally defined in 'lib_cfg.h'"
+#error  "                     [MUST be  DEF_DISABLED]         "
+#error  "                     [     ||  DEF_ENABLED ]         "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    LIBRARY CONFIGURATION ERRORS
@@ -72,6 +72,8 @@
 #define    LIB_STR_MODULE
 #include  <lib_str.h>
 
+#include  <stdarg.h>                                            /* See 'Str_Fmt_N()  Note #4'.                          */
+
 
 /*
 *********************************************************************************************************
@@ -79,6 +81,22 @@
 *********************************************************************************************************
 */
 
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* See 'Str_WordSkip()  Note #1'.                       */
+#define  STR_WORD_OCTETS_LO                      0x01010101u
+#define  STR_WORD_OCTETS_HI                      0x80808080u
+
+#define  STR_WORD_HAS_NUL(word)                ((((word) - STR_WORD_OCTETS_LO) & ~(word) & STR_WORD_OCTETS_HI) != 0u)
+#endif
+
+                                                                /* See 'Str_FmtNbr_Int32()  Note #8b'.                  */
+#define  STR_DIV_100_MULT                        0x51EB851Fu    /* = ceil(2^37 / 100).                                  */
+#define  STR_DIV_100_SHIFT                               37u
+
+#define  STR_DIV_100(nbr)                      ((CPU_INT32U)(((CPU_INT64U)(nbr) * STR_DIV_100_MULT) >> STR_DIV_100_SHIFT))
+
+                                                                /* Max nbr digs + neg sign + NUL (see 'Str_Fmt_N()').   */
+#define  STR_FMT_NBR_BUF_LEN                   (DEF_INT_32U_NBR_DIG_MAX + 2u)
+
 
 /*
 *********************************************************************************************************
@@ -140,6 +158,20 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
    (CPU_INT32U)(DEF_INT_32U_MAX_VAL / 36u)          /* 32-bit mult ovf th for base 36.  */
 };
 
+                                                                /* Dec dig pairs "00" .. "99" (NOT NULL-terminated) ... */
+static  const  CPU_CHAR  Str_DigPairTbl[200] = {                /* ... (see 'Str_FmtNbr_Int32()  Note #8b').            */
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+};
+
 
 /*
 *********************************************************************************************************
@@ -169,6 +201,34 @@ static  CPU_INT32U   Str_ParseNbr_Int32(const  CPU_CHAR      *pstr,
                                                CPU_BOOLEAN    nbr_signed,
                                                CPU_BOOLEAN   *pnbr_neg);
 
+static  CPU_SIZE_T   Str_SrchFactor    (const  CPU_CHAR      *pstr_srch,
+                                               CPU_SIZE_T     len_srch,
+                                               CPU_SIZE_T    *pperiod,
+                                               CPU_BOOLEAN   *pperiodic);
+
+static  CPU_CHAR    *Str_SrchTwoWay    (const  CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     len,
+                                        const  CPU_CHAR      *pstr_srch,
+                                               CPU_SIZE_T     len_srch,
+                                               CPU_SIZE_T     suffix_ix,
+                                               CPU_SIZE_T     period,
+                                               CPU_BOOLEAN    periodic,
+                                        const  CPU_INT08U    *pshift_tbl);
+
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+static  const  CPU_CHAR  *Str_WordSkip (const  CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     len_max,
+                                               CPU_CHAR       srch_char);
+
+static  CPU_SIZE_T   Str_WordCopy      (       CPU_CHAR     **ppstr_dest,
+                                        const  CPU_CHAR     **ppstr_src,
+                                               CPU_SIZE_T     len_max);
+
+static  CPU_SIZE_T   Str_WordCmp       (const  CPU_CHAR     **pp1_str,
+                                        const  CPU_CHAR     **pp2_str,
+                                               CPU_SIZE_T     len_max);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -272,6 +332,8 @@ CPU_SIZE_T  Str_Len (const  CPU_CHAR  *pstr)
 *
 *                   (c) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include the terminating NULL character.
+*
+*               (4) Whole words of the string are skipped first, if enabled (see 'Str_WordSkip()  Note #1').
 *********************************************************************************************************
 */
 
@@ -284,6 +346,12 @@ CPU_SIZE_T  Str_Len_N (const  CPU_CHAR    *pstr,
 
     pstr_len = pstr;
     len      = 0u;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+    if (pstr_len != (const CPU_CHAR *)0) {                      /* Skip words w/o NULL char (see Note #4).              */
+        pstr_len = Str_WordSkip(pstr_len, len_max, (CPU_CHAR)'\0');
+        len      = (CPU_SIZE_T)((CPU_ADDR)pstr_len - (CPU_ADDR)pstr);
+    }
+#endif
     while (( pstr_len != (const CPU_CHAR *)  0 ) &&             /* Calc str len until NULL ptr (see Note #3a) ...       */
            (*pstr_len != (      CPU_CHAR  )'\0') &&             /* ... or NULL char found      (see Note #3b) ...       */
            ( len      <  (      CPU_SIZE_T)len_max)) {          /* ... or max nbr chars srch'd (see Note #3c).          */
@@ -434,6 +502,9 @@ CPU_CHAR  *Str_Copy (       CPU_CHAR  *pstr_dest,
 *                           (see Note #2a1C).
 *                       (2) Null copies allowed (i.e. zero-length copies).
 *                           (A) No string copy performed; destination string returned  (see Note #2b1).
+*
+*               (4) Whole words of the source string are copied first, if enabled (see 'Str_WordCopy()
+*                   Note #1').
 *********************************************************************************************************
 */
 
@@ -457,6 +528,9 @@ CPU_CHAR  *Str_Copy_N (       CPU_CHAR    *pstr_dest,
     pstr_copy_dest = pstr_dest;
     pstr_copy_src  = pstr_src;
     len_copy       = 0u;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* Copy words w/o NULL char (see Note #4).              */
+    len_copy       = Str_WordCopy(&pstr_copy_dest, &pstr_copy_src, len_max);
+#endif
 
     while (( pstr_copy_dest != (      CPU_CHAR *)  0 ) &&       /* Copy str until NULL ptr(s)  [see Note #3b]  ...      */
            ( pstr_copy_src  != (const CPU_CHAR *)  0 ) &&
@@ -617,6 +691,9 @@ CPU_CHAR  *Str_Cat (       CPU_CHAR  *pstr_dest,
 *                       (2) Null concatenations allowed (i.e. zero-length concatenations).
 *                           (A) No string concatenation performed; destination string returned
 *                               (see Note #2b1).
+*
+*               (4) Whole words of the destination string are skipped & whole words of the concatenation
+*                   string are copied first, if enabled (see 'Str_WordSkip()  Note #1').
 *********************************************************************************************************
 */
 
@@ -642,6 +719,9 @@ CPU_CHAR  *Str_Cat_N (       CPU_CHAR    *pstr_dest,
 
 
     pstr_cat_dest = pstr_dest;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* Skip words w/o NULL char (see Note #4).              */
+    pstr_cat_dest = (CPU_CHAR *)Str_WordSkip(pstr_cat_dest, DEF_INT_CPU_U_MAX_VAL, (CPU_CHAR)'\0');
+#endif
     while (( pstr_cat_dest != (CPU_CHAR *)  0 ) &&              /* Adv to end of cur dest str until NULL ptr ...        */
            (*pstr_cat_dest != (CPU_CHAR  )'\0')) {              /* ... or NULL char found..                             */
         pstr_cat_dest++;
@@ -652,6 +732,9 @@ CPU_CHAR  *Str_Cat_N (       CPU_CHAR    *pstr_dest,
 
     pstr_cat_src = pstr_cat;
     len_cat      = 0u;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* Cat words w/o NULL char (see Note #4).               */
+    len_cat      = Str_WordCopy(&pstr_cat_dest, &pstr_cat_src, len_max);
+#endif
 
     while (( pstr_cat_dest != (      CPU_CHAR *)  0 ) &&        /* Cat str until NULL ptr(s)  [see Note #3b]  ...       */
            ( pstr_cat_src  != (const CPU_CHAR *)  0 ) &&
@@ -848,6 +931,8 @@ CPU_INT16S  Str_Cmp (const  CPU_CHAR  *p1_str,
 *
 *               (4) Since 16-bit signed arithmetic is performed to calculate a non-identical comparison
 *                   return value, 'CPU_CHAR' native data type size MUST be 8-bit.
+*
+*               (5) Whole identical words are skipped first, if enabled (see 'Str_WordCmp()  Note #1').
 *********************************************************************************************************
 */
 
@@ -882,11 +967,14 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
 
     p1_str_cmp      = p1_str;
     p2_str_cmp      = p2_str;
+    cmp_len         = 0u;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* Skip identical words (see Note #5).                  */
+    cmp_len         = Str_WordCmp(&p1_str_cmp, &p2_str_cmp, len_max);
+#endif
     p1_str_cmp_next = p1_str_cmp;
     p2_str_cmp_next = p2_str_cmp;
     p1_str_cmp_next++;
     p2_str_cmp_next++;
-    cmp_len         = 0u;
 
     while ((*p1_str_cmp      == *p2_str_cmp)            &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
            (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&      /* ... or NULL chars                 (see Note #3b) ... */
@@ -1344,6 +1432,9 @@ CPU_CHAR  *Str_Char (const  CPU_CHAR  *pstr,
 *                           of characters; NULL pointer returned.
 *                       (2) 'len_max' number of characters MAY include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) Whole words w/o search character are skipped first, if enabled (see 'Str_WordSkip()
+*                   Note #1').
 *********************************************************************************************************
 */
 
@@ -1366,6 +1457,10 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
 
     pstr_char = pstr;
     len_srch  = 0u;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* Skip words w/o srch char (see Note #4).              */
+    pstr_char = Str_WordSkip(pstr_char, len_max, srch_char);
+    len_srch  = (CPU_SIZE_T)((CPU_ADDR)pstr_char - (CPU_ADDR)pstr);
+#endif
 
     while (( pstr_char != (const CPU_CHAR *)  0 )      &&       /* Srch str until NULL ptr     [see Note #3b]  ...      */
            (*pstr_char != (      CPU_CHAR  )'\0')      &&       /* ... or NULL char            (see Note #3c)  ...      */
@@ -1839,7 +1934,9 @@ CPU_CHAR  *Str_Str (const  CPU_CHAR  *pstr,
 *
 *                   (f) Search string found.
 *                       (1) Return pointer to first occurrence of search string in string (see Note #2b1A).
-*                       (2) Search string found via Str_Cmp_N().
+*                       (2) Search string found via the Two-Way algorithm (see 'Str_SrchTwoWay()  Note #1');
+*                           in linear time & without any shift table.  Str_SrchPat_N() also uses a shift
+*                           table, for search strings searched for repeatedly.
 *
 *                   (g) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include terminating NULL character
@@ -1854,12 +1951,10 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
            CPU_SIZE_T    str_len;
            CPU_SIZE_T    str_len_srch;
            CPU_SIZE_T    len_max_srch;
-           CPU_SIZE_T    srch_len;
-           CPU_SIZE_T    srch_ix;
-           CPU_BOOLEAN   srch_done;
-           CPU_INT16S    srch_cmp;
+           CPU_SIZE_T    suffix_ix;
+           CPU_SIZE_T    period;
+           CPU_BOOLEAN   periodic;
     const  CPU_CHAR     *pstr_str;
-    const  CPU_CHAR     *pstr_srch_ix;
 
                                                                 /* Rtn NULL if str ptr(s) NULL (see Note #3a).          */
     if (pstr == (const CPU_CHAR *)0) {
@@ -1896,23 +1991,169 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
     }
 
 
-    srch_len  = str_len - str_len_srch;                         /* Calc srch len (see Note #3e2).                       */
-    srch_ix   = 0u;
-    srch_done = DEF_NO;
+    suffix_ix = Str_SrchFactor(pstr_srch,                       /* Factorize srch str (see Note #3f2).                  */
+                               str_len_srch,
+                              &period,
+                              &periodic);
+
+    pstr_str  = Str_SrchTwoWay(pstr,                            /* Rtn ptr to found srch str, or NULL (see Note #3e).   */
+                               str_len,
+                               pstr_srch,
+                               str_len_srch,
+                               suffix_ix,
+                               period,
+                               periodic,
+                               (const CPU_INT08U *)0);
+
+    return ((CPU_CHAR *)pstr_str);
+}
 
-    do {
-        pstr_srch_ix = (const CPU_CHAR *)(pstr + srch_ix);
-        srch_cmp     =  Str_Cmp_N(pstr_srch_ix, pstr_srch, str_len_srch);
-        srch_done    = (srch_cmp == 0) ? DEF_YES : DEF_NO;
-        srch_ix++;
-    } while ((srch_done == DEF_NO) && (srch_ix <= srch_len));
 
+/*
+*********************************************************************************************************
+*                                          Str_SrchPatInit()
+*
+* Description : Compile a search string, to search for it in many strings with Str_SrchPat_N().
+*
+* Argument(s) : ppat            Pointer to compiled search string to initialize.
+*
+*               pstr_srch       Pointer to search string (see Note #1).
+*
+* Return(s)   : DEF_OK,   if search string compiled.
+*
+*               DEF_FAIL, otherwise (see Note #2).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The search string is NOT copied & MUST remain valid & unmodified while the compiled
+*                   search string is in use (see 'lib_str.h  COMPILED SEARCH STRING DATA TYPE  Note #2').
+*
+*               (2) Compilation fails if either pointer is NULL or the search string overlaps the NULL
+*                   address.
+*
+*               (3) Compilation takes time linear in the search string length, plus a fixed time to
+*                   initialize the shift table.  No memory is allocated.
+*********************************************************************************************************
+*/
 
-    if (srch_cmp != 0) {                                        /* Rtn NULL if srch str NOT found (see Note #3e2).      */
+CPU_BOOLEAN  Str_SrchPatInit (       STR_SRCH_PAT  *ppat,
+                              const  CPU_CHAR      *pstr_srch)
+{
+    CPU_SIZE_T  len_srch;
+    CPU_SIZE_T  shift;
+    CPU_SIZE_T  i;
+
+                                                                /* Rtn fail if ptr(s) NULL (see Note #2).               */
+    if (ppat == (STR_SRCH_PAT *)0) {
+        return (DEF_FAIL);
+    }
+    if (pstr_srch == (const CPU_CHAR *)0) {
+        return (DEF_FAIL);
+    }
+
+    len_srch = Str_Len(pstr_srch);
+    if ((pstr_srch + len_srch) == (const CPU_CHAR *)0) {        /* Rtn fail if NULL ptr found (see Note #2).            */
+        return (DEF_FAIL);
+    }
+
+    ppat->PatPtr      = pstr_srch;
+    ppat->PatLen      = len_srch;
+    ppat->PatSuffixIx = Str_SrchFactor(pstr_srch,
+                                       len_srch,
+                                      &ppat->PatPeriod,
+                                      &ppat->PatPeriodic);
+
+                                                                /* Init shift tbl (see 'lib_str.h  Note #3').           */
+    shift = (len_srch < DEF_INT_08U_MAX_VAL) ? len_srch : DEF_INT_08U_MAX_VAL;
+    for (i = 0u; i <= DEF_INT_08U_MAX_VAL; i++) {
+        ppat->ShiftTbl[i] = (CPU_INT08U)shift;
+    }
+    for (i = 0u; i < len_srch; i++) {
+        shift = len_srch - i - 1u;
+        if (shift > DEF_INT_08U_MAX_VAL) {
+            shift = DEF_INT_08U_MAX_VAL;
+        }
+        ppat->ShiftTbl[(CPU_INT08U)pstr_srch[i]] = (CPU_INT08U)shift;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Str_SrchPat_N()
+*
+* Description : Search string for first occurence of a compiled search string, up to a maximum number
+*                   of characters.
+*
+* Argument(s) : ppat            Pointer to compiled search string (see Str_SrchPatInit()).
+*
+*               pstr            Pointer to string (see Note #1).
+*
+*               len_max         Maximum number of characters to search.
+*
+* Return(s)   : Pointer to first occurrence of search string in string, if any.
+*
+*               Pointer to string,                                      if NULL search string.
+*
+*               Pointer to NULL,                                        otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) String buffers NOT modified.
+*
+*               (2) Returns the same as Str_Str_N() for the search string 'ppat' was compiled from; see
+*                   'Str_Str_N()  Notes #2 & #3'.
+*
+*               (3) Since the last character of each search window is looked up in the shift table first,
+*                   most windows are skipped after a single compare; the worst case stays linear in the
+*                   string length.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_SrchPat_N (const  STR_SRCH_PAT  *ppat,
+                          const  CPU_CHAR      *pstr,
+                                 CPU_SIZE_T     len_max)
+{
+           CPU_SIZE_T   str_len;
+    const  CPU_CHAR    *pstr_str;
+
+                                                                /* Rtn NULL if ptr(s) NULL.                             */
+    if (ppat == (const STR_SRCH_PAT *)0) {
+        return ((CPU_CHAR *)0);
+    }
+    if (pstr == (const CPU_CHAR *)0) {
         return ((CPU_CHAR *)0);
     }
 
-    return ((CPU_CHAR *)pstr_srch_ix);                          /* Else rtn ptr to found srch str (see Note #3f1).      */
+    if (len_max < 1) {                                          /* Rtn NULL if srch len = 0.                            */
+        return ((CPU_CHAR *)0);
+    }
+
+    if (ppat->PatLen < 1) {                                     /* Rtn ptr to str if srch str len = 0.                  */
+        return ((CPU_CHAR *)pstr);
+    }
+
+    str_len = Str_Len_N(pstr, len_max);
+    if (ppat->PatLen > str_len) {                               /* Rtn NULL if srch str len > str len.                  */
+        return ((CPU_CHAR *)0);
+    }
+    pstr_str = pstr + str_len;                                  /* Rtn NULL if NULL ptr found.                          */
+    if (pstr_str == (const CPU_CHAR *)0) {
+        return ((CPU_CHAR *)0);
+    }
+
+    pstr_str = Str_SrchTwoWay(pstr,
+                              str_len,
+                              ppat->PatPtr,
+                              ppat->PatLen,
+                              ppat->PatSuffixIx,
+                              ppat->PatPeriod,
+                              ppat->PatPeriodic,
+                             &ppat->ShiftTbl[0]);
+
+    return ((CPU_CHAR *)pstr_str);
 }
 
 
@@ -2780,6 +3021,233 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                             Str_Fmt_N()
+*
+* Description : Format a string & arguments into a character string, up to a maximum number of characters.
+*
+* Argument(s) : pstr_dest       Pointer to character array to return formatted string (see Note #1).
+*
+*               len_max         Size of the character array, including the terminating NULL-character.
+*
+*               pfmt            Pointer to format string (see Note #2).
+*
+*               ...             Arguments to format, one per conversion specification.
+*
+* Return(s)   : Pointer to formatted string, if NO error(s) [see Note #3].
+*
+*               Pointer to NULL,             otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The formatted string is ALWAYS NULL-character terminated; it is silently truncated to
+*                   ('len_max' - 1) characters.
+*
+*               (2) (a) A subset of the 'printf()' conversion specifications is supported :
+*
+*                           %[0][width][l]conversion
+*
+*                       where
+*                               0               Pad numbers with '0' digits, after any negative sign;
+*                                                   pad with spaces otherwise.
+*                               width           Minimum number of characters to format.
+*                               l               'long' argument; 'int' argument otherwise.
+*                               conversion      One of :
+*
+*                                                   s       String
+*                                                   d       Signed   decimal integer
+*                                                   u       Unsigned decimal integer
+*                                                   x       Unsigned hexadecimal integer, lower case
+*                                                   X       Unsigned hexadecimal integer, upper case
+*                                                   %       '%' character
+*
+*                   (b) Integers are formatted as 32-bit integers by Str_FmtNbr_Int32().
+*
+*                   (c) For any other conversion character, the '%' & the character are copied to the
+*                       string as is.
+*
+*               (3) String format terminates when :
+*
+*                   (a) Destination/format string pointer is passed a NULL pointer, or 'len_max' is
+*                       zero.
+*                       (1) No    string formatted;                NULL pointer returned.
+*
+*                   (b) Format string terminating NULL-character found, or destination string full.
+*                       (1) Entire/truncated string formatted;   Destination string pointer returned.
+*
+*               (4) Str_Fmt_N() formats with NO reference to the standard library's 'printf()' family,
+*                   & thus neither pulls in its code nor allocates from its heap.  Only the compiler-
+*                   supplied 'stdarg.h' macros are used to access the arguments.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Fmt_N (       CPU_CHAR    *pstr_dest,
+                             CPU_SIZE_T   len_max,
+                      const  CPU_CHAR    *pfmt,
+                                          ...)
+{
+    va_list            fmt_args;
+    CPU_CHAR          *pstr_fmt;
+    CPU_CHAR          *pstr_end;
+    const  CPU_CHAR   *pstr_arg;
+    CPU_CHAR           nbr_str[STR_FMT_NBR_BUF_LEN];
+    CPU_CHAR           fmt_char;
+    CPU_CHAR           lead_char;
+    CPU_SIZE_T         fmt_width;
+    CPU_SIZE_T         len_arg;
+    CPU_INT32U         nbr;
+    CPU_INT32S         nbr_signed;
+    CPU_INT08U         nbr_base;
+    CPU_BOOLEAN        nbr_neg;
+    CPU_BOOLEAN        nbr_long;
+    CPU_BOOLEAN        lower_case;
+
+
+                                                                /* ---------------- VALIDATE FMT ARGS ----------------- */
+    if (pstr_dest == (CPU_CHAR *)0) {                           /* Rtn NULL if dest str ptr NULL (see Note #3a).        */
+        return ((CPU_CHAR *)0);
+    }
+    if (pfmt      == (const CPU_CHAR *)0) {                     /* Rtn NULL if fmt  str ptr NULL (see Note #3a).        */
+        return ((CPU_CHAR *)0);
+    }
+    if (len_max   == 0u) {                                      /* Rtn NULL if fmt len equals zero (see Note #3a).      */
+        return ((CPU_CHAR *)0);
+    }
+
+
+    pstr_fmt = pstr_dest;
+    pstr_end = pstr_dest + (len_max - 1u);                      /* Rsv last char for NULL char (see Note #1).           */
+
+    va_start(fmt_args, pfmt);
+
+    while ((*pfmt    != (CPU_CHAR)'\0') &&                      /* Fmt str until end of fmt str    ...                  */
+           ( pstr_fmt <  pstr_end)) {                           /* ... or dest str full (see Note #3b).                 */
+
+        if (*pfmt != (CPU_CHAR)'%') {                           /* Copy non-conversion chars.                           */
+           *pstr_fmt++ = *pfmt++;
+            continue;
+        }
+        pfmt++;
+                                                                /* ------------ PARSE CONVERSION SPEC'N --------------- */
+        lead_char = (CPU_CHAR)' ';
+        if (*pfmt == (CPU_CHAR)'0') {                           /* Parse '0' pad flag ...                               */
+            lead_char = (CPU_CHAR)'0';
+            pfmt++;
+        }
+
+        fmt_width = 0u;                                         /* ... & min width ...                                  */
+        while (ASCII_IS_DIG(*pfmt) == DEF_YES) {
+            fmt_width = (fmt_width * 10u) + (CPU_SIZE_T)(*pfmt - '0');
+            pfmt++;
+        }
+
+        nbr_long = DEF_NO;                                      /* ... & 'long' len modifier (see Note #2a).            */
+        if (*pfmt == (CPU_CHAR)'l') {
+            nbr_long = DEF_YES;
+            pfmt++;
+        }
+
+        fmt_char = *pfmt;
+        if (fmt_char == (CPU_CHAR)'\0') {                       /* If fmt str ends in conversion spec'n, ...            */
+            break;                                              /* ... ignore spec'n.                                   */
+        }
+        pfmt++;
+
+                                                                /* ----------------- FMT CONVERSION ------------------- */
+        switch (fmt_char) {
+            case 's':
+                 pstr_arg = va_arg(fmt_args, const CPU_CHAR *);
+                 if (pstr_arg == (const CPU_CHAR *)0) {
+                     pstr_arg = (const CPU_CHAR *)"";
+                 }
+                 lead_char = (CPU_CHAR)' ';                     /* Pad str with spaces only (see Note #2a).             */
+                 break;
+
+
+            case 'd':
+            case 'u':
+            case 'x':
+            case 'X':
+                 nbr_neg = DEF_NO;
+                 if (fmt_char == (CPU_CHAR)'d') {               /* Get signed nbr arg; ...                              */
+                     if (nbr_long == DEF_YES) {
+                         nbr_signed = (CPU_INT32S)va_arg(fmt_args, long);
+                     } else {
+                         nbr_signed = (CPU_INT32S)va_arg(fmt_args, int);
+                     }
+                     nbr = (CPU_INT32U)nbr_signed;
+                     if (nbr_signed < 0) {                      /* ... & if nbr neg, negate nbr.                        */
+                         nbr     = (CPU_INT32U)0u - nbr;
+                         nbr_neg =  DEF_YES;
+                     }
+                 } else {                                       /* Get unsigned nbr arg.                                */
+                     if (nbr_long == DEF_YES) {
+                         nbr = (CPU_INT32U)va_arg(fmt_args, unsigned long);
+                     } else {
+                         nbr = (CPU_INT32U)va_arg(fmt_args, unsigned int);
+                     }
+                 }
+
+                 nbr_base   = ((fmt_char == (CPU_CHAR)'x') ||
+                               (fmt_char == (CPU_CHAR)'X')) ? DEF_NBR_BASE_HEX : DEF_NBR_BASE_DEC;
+                 lower_case =  (fmt_char == (CPU_CHAR)'x')  ? DEF_YES          : DEF_NO;
+
+                 (void)Str_FmtNbr_Int32(nbr,                    /* Fmt nbr with NO lead chars (see Note #2b).           */
+                                        STR_FMT_NBR_BUF_LEN - 1u,
+                                        nbr_base,
+                                        nbr_neg,
+                                        (CPU_CHAR)'\0',
+                                        lower_case,
+                                        DEF_YES,
+                                        nbr_str);
+                 pstr_arg = nbr_str;
+
+                 if ((nbr_neg   == DEF_YES) &&                  /* If nbr neg & padded with '0' digs, ...               */
+                     (lead_char == (CPU_CHAR)'0')) {
+                    *pstr_fmt++ = *pstr_arg++;                  /* ... fmt neg sign before pad digs.                    */
+                     if (fmt_width > 0u) {
+                         fmt_width--;
+                     }
+                 }
+                 break;
+
+
+            case '%':
+                 pstr_arg  = (const CPU_CHAR *)"%";
+                 fmt_width =  0u;
+                 break;
+
+
+            default:                                            /* Copy unsupported conversion (see Note #2c).          */
+                 pstr_arg  = (const CPU_CHAR *)"%";
+                 fmt_width =  0u;
+                 pfmt--;
+                 break;
+        }
+
+                                                                /* --------------- PAD & COPY ARG STR ----------------- */
+        len_arg = Str_Len_N(pstr_arg, fmt_width);
+        while ((fmt_width > len_arg) &&                         /* Pad arg str up to min width ...                      */
+               (pstr_fmt  < pstr_end)) {
+           *pstr_fmt++ = lead_char;
+            fmt_width--;
+        }
+        while ((*pstr_arg != (CPU_CHAR)'\0') &&                 /* ... & copy arg str.                                  */
+               ( pstr_fmt <  pstr_end)) {
+           *pstr_fmt++ = *pstr_arg++;
+        }
+    }
+
+    va_end(fmt_args);
+
+   *pstr_fmt = (CPU_CHAR)'\0';                                  /* Append NULL char (see Note #1).                      */
+
+
+    return (pstr_dest);                                         /* Rtn ptr to fmt'd str (see Note #3b).                 */
+}
+
+
 /*
 *********************************************************************************************************
 *                                        Str_ParseNbr_Int32U()
@@ -3442,6 +3910,14 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
 *                          number of     =  {
 *                       question marks      {  (b)  'nbr_dig'         ,  if 'nbr_dig' > 0
 *
+*               (8) (a) Decimal digits are counted by comparing the number to powers of 10; digits of
+*                       power-of-2 bases are counted & formatted with shifts & masks.
+*
+*                   (b) Decimal digits are formatted two at a time from 'Str_DigPairTbl[]'.  Each pair
+*                       costs one division by 100, performed as a multiplication by the reciprocal of 100
+*                       scaled by 2^37 (see 'STR_DIV_100()'), which is exact for any 32-bit number.
+*
+*                   (c) Other bases are formatted one digit at a time by division.
 *********************************************************************************************************
 */
 
@@ -3458,12 +3934,15 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     CPU_DATA      i;
     CPU_INT32U    nbr_fmt;
     CPU_INT32U    nbr_log;
+    CPU_INT32U    nbr_quot;
     CPU_INT08U    nbr_dig_max;
     CPU_INT08U    nbr_dig_min;
     CPU_INT08U    nbr_dig_fmtd;
     CPU_INT08U    nbr_neg_sign;
     CPU_INT08U    nbr_lead_char;
+    CPU_INT08U    nbr_shift;
     CPU_INT08U    dig_val;
+    CPU_INT08U    dig_ix;
     CPU_INT08U    lead_char_delta_0;
     CPU_INT08U    lead_char_delta_a;
     CPU_BOOLEAN   lead_char_dig;
@@ -3471,6 +3950,7 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     CPU_BOOLEAN   fmt_invalid;
     CPU_BOOLEAN   print_char;
     CPU_BOOLEAN   nbr_neg_fmtd;
+    CPU_BOOLEAN   nbr_base_pwr2;
 
 
                                                                 /* ---------------- VALIDATE FMT ARGS ----------------- */
@@ -3519,12 +3999,35 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     lead_char_0 = DEF_NO;
 
     if (fmt_invalid == DEF_NO) {
-        nbr_fmt     = nbr;
-        nbr_log     = nbr;
-        nbr_dig_max = 1u;
-        while (nbr_log >= nbr_base) {                           /* While nbr base digs avail, ...                       */
-            nbr_dig_max++;                                      /* ... calc max nbr digs.                               */
-            nbr_log /= nbr_base;
+        nbr_fmt       = nbr;
+        nbr_dig_max   = 1u;
+        nbr_shift     = 0u;
+        nbr_base_pwr2 = ((nbr_base & (nbr_base - 1u)) == 0u) ? DEF_YES : DEF_NO;
+
+        if (nbr_base == 10u) {                                  /* Cnt dec digs by cmp (see Note #8a) :                 */
+            nbr_log = 10u;
+            while ((nbr         >= nbr_log) &&                  /* While nbr >= next pwr of 10,          ...            */
+                   (nbr_dig_max <  DEF_INT_32U_NBR_DIG_MAX)) {  /* ... & NOT on last pwr of 10 avail,    ...            */
+                nbr_dig_max++;                                  /* ... calc max nbr digs.                               */
+                nbr_log *= 10u;
+            }
+
+        } else if (nbr_base_pwr2 == DEF_YES) {                  /* Cnt pwr-of-2 base digs by shift (see Note #8a).      */
+            while (((CPU_INT32U)1u << nbr_shift) < nbr_base) {
+                nbr_shift++;
+            }
+            nbr_log = nbr >> nbr_shift;
+            while (nbr_log > 0u) {
+                nbr_dig_max++;
+                nbr_log >>= nbr_shift;
+            }
+
+        } else {
+            nbr_log = nbr;
+            while (nbr_log >= nbr_base) {                       /* While nbr base digs avail, ...                       */
+                nbr_dig_max++;                                  /* ... calc max nbr digs.                               */
+                nbr_log /= nbr_base;
+            }
         }
 
         nbr_neg_sign = (nbr_neg == DEF_YES) ? 1u : 0u;
@@ -3564,13 +4067,34 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     }
     pstr_fmt--;
 
+    i = 0u;
+    if (fmt_invalid == DEF_NO) {                                /* Fmt all nbr digs, incl one's dig (see Note #3c1) :   */
+        if (nbr_base == 10u) {
+            while (nbr_fmt >= 100u) {                           /* Fmt two dec digs per div (see Note #8b).             */
+                nbr_quot    =  STR_DIV_100(nbr_fmt);
+                dig_ix      = (CPU_INT08U)((nbr_fmt - (nbr_quot * 100u)) * 2u);
+               *pstr_fmt--  =  Str_DigPairTbl[dig_ix + 1u];
+               *pstr_fmt--  =  Str_DigPairTbl[dig_ix];
+                nbr_fmt     =  nbr_quot;
+            }
+            if (nbr_fmt >= 10u) {                               /* Fmt last two dec digs ...                            */
+                dig_ix      = (CPU_INT08U)(nbr_fmt * 2u);
+               *pstr_fmt--  =  Str_DigPairTbl[dig_ix + 1u];
+               *pstr_fmt--  =  Str_DigPairTbl[dig_ix];
+            } else {                                            /* ... or last dec dig.                                 */
+               *pstr_fmt--  = (CPU_CHAR)(nbr_fmt + '0');
+            }
+
+        } else {
+            do {
+                if (nbr_base_pwr2 == DEF_YES) {                 /* Calc dig val by mask & shift (see Note #8a) ...      */
+                    dig_val   = (CPU_INT08U)(nbr_fmt & (nbr_base - 1u));
+                    nbr_fmt >>=  nbr_shift;
+                } else {                                        /* ... or by div (see Note #8c).                        */
+                    dig_val   = (CPU_INT08U)(nbr_fmt % nbr_base);
+                    nbr_fmt  /=  nbr_base;
+                }
 
-    for (i = 0u; i < nbr_dig_fmtd; i++) {                       /* Fmt str for desired nbr digs :                       */
-        if (fmt_invalid == DEF_NO) {
-            if ((nbr_fmt > 0) ||                                /* If fmt nbr > 0                               ...     */
-                (i == 0u)) {                                    /* ... OR on one's  dig to fmt (see Note #3c1), ...     */
-                                                                /* ... calc & fmt dig val;                      ...     */
-                dig_val = (CPU_INT08U)(nbr_fmt % nbr_base);
                 if (dig_val < 10u) {
                    *pstr_fmt-- = (CPU_CHAR)(dig_val + '0');
                 } else {
@@ -3580,14 +4104,20 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
                        *pstr_fmt--  = (CPU_CHAR)((dig_val - 10u) + 'a');
                     }
                 }
+            } while (nbr_fmt > 0u);                             /* Shift to next more-sig dig.                          */
+        }
 
-                nbr_fmt /= nbr_base;                            /* Shift to next more-sig dig.                          */
+        i = nbr_dig_max;
+    }
 
-            } else if ((nbr_neg      == DEF_YES)  &&            /* ... else if nbr neg             AND          ...     */
-                     (((lead_char_0  == DEF_NO )  &&            /* ... lead char NOT a '0' dig                  ...     */
-                       (nbr_neg_fmtd == DEF_NO )) ||            /* ... but neg sign NOT yet fmt'd  OR           ...     */
-                      ((lead_char_0  != DEF_NO )  &&            /* ... lead char is  a '0' dig                  ...     */
-                       (i == (nbr_dig_fmtd - 1u))))) {          /* ... & on most-sig dig to fmt,                ...     */
+
+    for (; i < nbr_dig_fmtd; i++) {                             /* Fmt str for remaining nbr digs :                     */
+        if (fmt_invalid == DEF_NO) {
+            if ((nbr_neg      == DEF_YES)  &&                   /* If nbr neg                      AND          ...     */
+              (((lead_char_0  == DEF_NO )  &&                   /* ... lead char NOT a '0' dig                  ...     */
+                (nbr_neg_fmtd == DEF_NO )) ||                   /* ... but neg sign NOT yet fmt'd  OR           ...     */
+               ((lead_char_0  != DEF_NO )  &&                   /* ... lead char is  a '0' dig                  ...     */
+                (i == (nbr_dig_fmtd - 1u))))) {                 /* ... & on most-sig dig to fmt,                ...     */
 
                *pstr_fmt--   = '-';                             /* ... prepend neg sign (see Note #3b);         ...     */
                 nbr_neg_fmtd = DEF_YES;
@@ -4039,3 +4569,495 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
     return (nbr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                          Str_SrchFactor()
+*
+* Description : Compute the critical factorization of a search string for the Two-Way algorithm.
+*
+* Argument(s) : pstr_srch       Pointer to search string.
+*
+*               len_srch        Length  of search string.
+*
+*               pperiod         Pointer to variable that will receive the shift after a mismatch in the
+*                                   left half : the search string's period if periodic (see Note #2), else
+*                                   a shift past the left half.
+*
+*               pperiodic       Pointer to variable that will receive whether the search string is
+*                                   periodic.
+*
+* Return(s)   : Index of the first character of the right half.
+*
+* Caller(s)   : Str_Str_N(),
+*               Str_SrchPatInit().
+*
+* Note(s)     : (1) The right half starts at the longer of the maximal suffixes for the character order &
+*                   for the reverse order; the split is then critical, i.e. its local period equals the
+*                   period of the search string.  See Crochemore & Perrin, "Two-way string-matching",
+*                   Journal of the ACM 38(3), 1991.
+*
+*               (2) The search string is periodic if its left half occurs again one period to the right;
+*                   the search then remembers how much of the right half already matched.
+*
+*               (3) Both maximal suffix searches start at index -1, held modulo 2^N in the unsigned suffix
+*                   index so that 'suffix_ix + k' is the intended index.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Str_SrchFactor (const  CPU_CHAR     *pstr_srch,
+                                           CPU_SIZE_T    len_srch,
+                                           CPU_SIZE_T   *pperiod,
+                                           CPU_BOOLEAN  *pperiodic)
+{
+    CPU_SIZE_T  suffix_ix;
+    CPU_SIZE_T  suffix_ix_rev;
+    CPU_SIZE_T  period;
+    CPU_SIZE_T  ix;
+    CPU_SIZE_T  k;
+    CPU_SIZE_T  p;
+    CPU_INT08U  a;
+    CPU_INT08U  b;
+    CPU_INT16S  cmp_val;
+
+
+    if (len_srch < 3u) {                                        /* Any split of a short srch str is critical.           */
+        suffix_ix = (len_srch > 0u) ? (len_srch - 1u) : 0u;
+        period    =  1u;
+    } else {
+                                                                /* Max suffix for char order (see Note #3).             */
+        suffix_ix = (CPU_SIZE_T)0u - 1u;
+        ix        = 0u;
+        k         = 1u;
+        p         = 1u;
+        while ((ix + k) < len_srch) {
+            a = (CPU_INT08U)pstr_srch[ix        + k];
+            b = (CPU_INT08U)pstr_srch[suffix_ix + k];
+            if (a < b) {                                        /* Suffix smaller : period is entire prefix so far.     */
+                ix += k;
+                k   = 1u;
+                p   = ix - suffix_ix;
+            } else if (a == b) {                                /* Advance through repetition of current period.        */
+                if (k != p) {
+                    k++;
+                } else {
+                    ix += p;
+                    k   = 1u;
+                }
+            } else {                                            /* Suffix larger : start over from current ix.          */
+                suffix_ix = ix;
+                ix++;
+                k = 1u;
+                p = 1u;
+            }
+        }
+        period = p;
+                                                                /* Max suffix for reverse char order.                   */
+        suffix_ix_rev = (CPU_SIZE_T)0u - 1u;
+        ix            = 0u;
+        k             = 1u;
+        p             = 1u;
+        while ((ix + k) < len_srch) {
+            a = (CPU_INT08U)pstr_srch[ix            + k];
+            b = (CPU_INT08U)pstr_srch[suffix_ix_rev + k];
+            if (b < a) {
+                ix += k;
+                k   = 1u;
+                p   = ix - suffix_ix_rev;
+            } else if (a == b) {
+                if (k != p) {
+                    k++;
+                } else {
+                    ix += p;
+                    k   = 1u;
+                }
+            } else {
+                suffix_ix_rev = ix;
+                ix++;
+                k = 1u;
+                p = 1u;
+            }
+        }
+                                                                /* Choose longer suffix (see Note #1).                  */
+        if ((suffix_ix_rev + 1u) < (suffix_ix + 1u)) {
+            suffix_ix = suffix_ix + 1u;
+        } else {
+            suffix_ix = suffix_ix_rev + 1u;
+            period    = p;
+        }
+    }
+
+                                                                /* Chk if srch str periodic (see Note #2).              */
+    cmp_val = Str_Cmp_N(pstr_srch, pstr_srch + period, suffix_ix);
+    if (cmp_val == 0) {
+       *pperiodic = DEF_YES;
+       *pperiod   = period;
+    } else {
+       *pperiodic = DEF_NO;
+       *pperiod   = ((suffix_ix > (len_srch - suffix_ix)) ? suffix_ix : (len_srch - suffix_ix)) + 1u;
+    }
+
+    return (suffix_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Str_SrchTwoWay()
+*
+* Description : Search string for first occurence of a factorized search string.
+*
+* Argument(s) : pstr            Pointer to string.
+*
+*               len             Length  of string (in characters).
+*
+*               pstr_srch       Pointer to search string.
+*
+*               len_srch        Length  of search string (in characters), at least 1 & at most 'len'.
+*
+*               suffix_ix       Index of right half of search string (see Str_SrchFactor()).
+*
+*               period          Shift after a mismatch in the left half (see Str_SrchFactor()).
+*
+*               periodic        Indicates whether search string is periodic (see Str_SrchFactor()).
+*
+*               pshift_tbl      Pointer to shift table (see 'lib_str.h  COMPILED SEARCH STRING DATA
+*                                   TYPE  Note #3'), or NULL to compare every window.
+*
+* Return(s)   : Pointer to first occurrence of search string in string, if any.
+*
+*               Pointer to NULL,                                        otherwise.
+*
+* Caller(s)   : Str_Str_N(),
+*               Str_SrchPat_N().
+*
+* Note(s)     : (1) Each search window is first compared over the right half of the search string, left to
+*                   right; a mismatch there shifts the window past the mismatched character.  Only if the
+*                   right half matches is the left half compared, right to left; a mismatch there shifts
+*                   the window by 'period'.  Each string character is thus compared a bounded number of
+*                   times, i.e. the search runs in linear time with constant space.
+*
+*               (2) For a periodic search string, the characters that still match after a left half
+*                   mismatch are remembered in 'mem' & are NOT compared again.
+*
+*               (3) A shift table lets windows whose last character does not fit be skipped without
+*                   comparing the halves (Boyer-Moore-Horspool rule); shifts are never longer than the
+*                   distance to the next possible match, so the result is unchanged.
+*********************************************************************************************************
+*/
+
+static  CPU_CHAR  *Str_SrchTwoWay (const  CPU_CHAR     *pstr,
+                                          CPU_SIZE_T    len,
+                                   const  CPU_CHAR     *pstr_srch,
+                                          CPU_SIZE_T    len_srch,
+                                          CPU_SIZE_T    suffix_ix,
+                                          CPU_SIZE_T    period,
+                                          CPU_BOOLEAN   periodic,
+                                   const  CPU_INT08U   *pshift_tbl)
+{
+    CPU_SIZE_T  win_ix;
+    CPU_SIZE_T  win_ix_max;
+    CPU_SIZE_T  mem;
+    CPU_SIZE_T  shift;
+    CPU_SIZE_T  i;
+
+
+    win_ix     = 0u;
+    win_ix_max = len - len_srch;
+    mem        = 0u;
+    while (win_ix <= win_ix_max) {
+        if (pshift_tbl != (const CPU_INT08U *)0) {              /* Chk last char first (see Note #3).                   */
+            shift = pshift_tbl[(CPU_INT08U)pstr[win_ix + len_srch - 1u]];
+            if (shift > 0u) {
+                if ((mem > 0u) && (shift < period)) {           /* Periodic srch str with a char out of place.          */
+                    shift = len_srch - period;
+                }
+                mem     = 0u;
+                win_ix += shift;
+                continue;
+            }
+        }
+                                                                /* Cmp right half.                                      */
+        i = (suffix_ix > mem) ? suffix_ix : mem;
+        while ((i < len_srch) &&
+               (pstr_srch[i] == pstr[win_ix + i])) {
+            i++;
+        }
+        if (i < len_srch) {                                     /* Shift past right half mismatch.                      */
+            win_ix += i - suffix_ix + 1u;
+            mem     = 0u;
+            continue;
+        }
+                                                                /* Cmp left half.                                       */
+        i = suffix_ix;
+        while ((i > mem) &&
+               (pstr_srch[i - 1u] == pstr[win_ix + i - 1u])) {
+            i--;
+        }
+        if (i <= mem) {                                         /* Srch str found.                                      */
+            return ((CPU_CHAR *)(pstr + win_ix));
+        }
+        win_ix += period;                                       /* Shift by period (see Note #2).                       */
+        if (periodic == DEF_YES) {
+            mem = len_srch - period;
+        }
+    }
+
+    return ((CPU_CHAR *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Str_WordSkip()
+*
+* Description : Skip the leading whole words of a string that contain neither the terminating NULL
+*                   character nor a search character.
+*
+* Argument(s) : pstr        Pointer to string (see Note #3).
+*
+*               len_max     Maximum number of characters to skip.
+*
+*               srch_char   Search character; '\0' to stop on the terminating NULL character only.
+*
+* Return(s)   : Pointer to the first character NOT skipped; the caller searches on from there one
+*                   character at a time.
+*
+* Caller(s)   : Str_Len_N(),
+*               Str_Cat_N(),
+*               Str_Char_N().
+*
+* Note(s)     : (1) A word contains an octet of value zero if & only if :
+*
+*                       ((word - 0x01010101) & ~word & 0x80808080) != 0
+*
+*                   & it contains the search character if 'word' XOR'd with the search character in
+*                   every octet contains an octet of value zero.  Thus each word is checked with a
+*                   few arithmetic instructions instead of four compares & branches.
+*
+*               (2) (a) Leading characters are skipped one at a time up to the next word boundary, since
+*                       words MUST be read from word-aligned addresses (see 'lib_mem.c  Mem_Set()
+*                       Note #2').
+*
+*                   (b) A word-aligned read of the word holding the terminating NULL character never
+*                       crosses into the next word, so it can NOT fault even if the string ends at the
+*                       end of a memory region.
+*
+*               (3) Only characters that the caller's own search would have passed over are skipped, so
+*                   results are identical with & without LIB_STR_CFG_WORD_EN; this includes stopping on
+*                   the NULL address (see 'Str_Len_N()  Note #3a').
+*
+*               (4) 'pstr' MUST NOT be NULL.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+static  const  CPU_CHAR  *Str_WordSkip (const  CPU_CHAR    *pstr,
+                                               CPU_SIZE_T   len_max,
+                                               CPU_CHAR     srch_char)
+{
+    const  CPU_INT32U  *pstr_word;
+           CPU_INT32U   word;
+           CPU_INT32U   srch_word;
+           CPU_SIZE_T   len_rem;
+
+
+    len_rem = len_max;
+    while (((CPU_ADDR)pstr % sizeof(CPU_INT32U)) != 0u) {       /* Skip leading chars up to word boundary (Note #2a).   */
+        if (( len_rem <  1u) ||
+            (*pstr    == (CPU_CHAR)'\0') ||
+            (*pstr    == srch_char)) {
+            return (pstr);
+        }
+        pstr++;
+        len_rem--;
+    }
+
+    srch_word = (CPU_INT32U)((CPU_INT08U)srch_char) * STR_WORD_OCTETS_LO;
+    pstr_word = (const CPU_INT32U *)pstr;
+    while ((pstr_word != (const CPU_INT32U *)0) &&              /* Skip words until NULL ptr ...                        */
+           (len_rem   >= sizeof(CPU_INT32U))) {                 /* ... or max nbr chars skipped.                        */
+        word = *pstr_word;
+        if ((STR_WORD_HAS_NUL(word)) ||                         /* Stop at word with NULL char ...                      */
+            (STR_WORD_HAS_NUL(word ^ srch_word))) {             /* ... or srch char (see Note #1).                      */
+            break;
+        }
+        pstr_word++;
+        len_rem -= sizeof(CPU_INT32U);
+    }
+
+    return ((const CPU_CHAR *)pstr_word);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Str_WordCopy()
+*
+* Description : Copy the leading whole words of a source string that do NOT contain the terminating NULL
+*                   character.
+*
+* Argument(s) : ppstr_dest  Pointer to destination string pointer; advanced past the characters copied.
+*
+*               ppstr_src   Pointer to source      string pointer; advanced past the characters copied.
+*
+*               len_max     Maximum number of characters to copy.
+*
+* Return(s)   : Number of characters copied; the caller copies on from there one character at a time.
+*
+* Caller(s)   : Str_Copy_N(),
+*               Str_Cat_N().
+*
+* Note(s)     : (1) Words are only copied if destination & source are aligned alike; otherwise NO
+*                   characters are copied.  See also 'Str_WordSkip()  Notes #1, #2 & #3'.
+*
+*               (2) Neither string pointer may be NULL.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Str_WordCopy (       CPU_CHAR    **ppstr_dest,
+                                  const  CPU_CHAR    **ppstr_src,
+                                         CPU_SIZE_T    len_max)
+{
+           CPU_CHAR     *pstr_dest;
+    const  CPU_CHAR     *pstr_src;
+           CPU_INT32U   *pstr_dest_word;
+    const  CPU_INT32U   *pstr_src_word;
+           CPU_INT32U    word;
+           CPU_SIZE_T    len_copy;
+
+
+    pstr_dest = *ppstr_dest;
+    pstr_src  = *ppstr_src;
+    if ((((CPU_ADDR)pstr_dest ^ (CPU_ADDR)pstr_src) % sizeof(CPU_INT32U)) != 0u) {
+        return (0u);                                            /* Rtn if NOT aligned alike (see Note #1).              */
+    }
+
+    len_copy = 0u;
+    while (((CPU_ADDR)pstr_src % sizeof(CPU_INT32U)) != 0u) {   /* Copy leading chars up to word boundary.              */
+        if (( len_copy >= len_max) ||
+            (*pstr_src == (CPU_CHAR)'\0')) {
+           *ppstr_dest = pstr_dest;
+           *ppstr_src  = pstr_src;
+            return (len_copy);
+        }
+       *pstr_dest = *pstr_src;
+        pstr_dest++;
+        pstr_src++;
+        len_copy++;
+    }
+
+    pstr_dest_word = (      CPU_INT32U *)pstr_dest;
+    pstr_src_word  = (const CPU_INT32U *)pstr_src;
+    while ((pstr_dest_word       != (      CPU_INT32U *)0) &&   /* Copy words until NULL ptr(s) ...                     */
+           (pstr_src_word        != (const CPU_INT32U *)0) &&
+           ((len_max - len_copy) >= sizeof(CPU_INT32U))) {      /* ... or max nbr chars copied.                         */
+        word = *pstr_src_word;
+        if (STR_WORD_HAS_NUL(word)) {                           /* Stop at word with NULL char.                         */
+            break;
+        }
+       *pstr_dest_word = word;
+        pstr_dest_word++;
+        pstr_src_word++;
+        len_copy += sizeof(CPU_INT32U);
+    }
+
+   *ppstr_dest = (      CPU_CHAR *)pstr_dest_word;
+   *ppstr_src  = (const CPU_CHAR *)pstr_src_word;
+
+    return (len_copy);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Str_WordCmp()
+*
+* Description : Skip the leading whole words that are identical in two strings & do NOT contain the
+*                   terminating NULL character.
+*
+* Argument(s) : pp1_str     Pointer to first  string pointer; advanced past the characters skipped.
+*
+*               pp2_str     Pointer to second string pointer; advanced past the characters skipped.
+*
+*               len_max     Maximum number of characters to skip.
+*
+* Return(s)   : Number of characters skipped; the caller compares on from there one character at a time.
+*
+* Caller(s)   : Str_Cmp_N().
+*
+* Note(s)     : (1) Words are only compared if both strings are aligned alike; otherwise NO characters
+*                   are skipped.  See also 'Str_WordSkip()  Notes #1, #2 & #3'.
+*
+*               (2) A word is NOT skipped if the word after it starts at the NULL address, since
+*                   Str_Cmp_N() stops one character before the NULL address (see 'Str_Cmp_N()
+*                   Note #3a2').
+*
+*               (3) Neither string pointer may be NULL.
+*********************************************************************************************************
+*/
+
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Str_WordCmp (const  CPU_CHAR    **pp1_str,
+                                 const  CPU_CHAR    **pp2_str,
+                                        CPU_SIZE_T    len_max)
+{
+    const  CPU_CHAR     *p1_str;
+    const  CPU_CHAR     *p2_str;
+    const  CPU_INT32U   *p1_str_word;
+    const  CPU_INT32U   *p2_str_word;
+           CPU_INT32U    word;
+           CPU_SIZE_T    cmp_len;
+
+
+    p1_str = *pp1_str;
+    p2_str = *pp2_str;
+    if ((((CPU_ADDR)p1_str ^ (CPU_ADDR)p2_str) % sizeof(CPU_INT32U)) != 0u) {
+        return (0u);                                            /* Rtn if NOT aligned alike (see Note #1).              */
+    }
+
+    cmp_len = 0u;
+    while (((CPU_ADDR)p1_str % sizeof(CPU_INT32U)) != 0u) {     /* Skip leading chars up to word boundary.              */
+        if (( cmp_len      >= len_max) ||
+            (*p1_str       != *p2_str) ||
+            (*p1_str       == (CPU_CHAR)'\0') ||
+            ((p1_str + 1)  == (const CPU_CHAR *)0) ||           /* See Note #2.                                         */
+            ((p2_str + 1)  == (const CPU_CHAR *)0)) {
+           *pp1_str = p1_str;
+           *pp2_str = p2_str;
+            return (cmp_len);
+        }
+        p1_str++;
+        p2_str++;
+        cmp_len++;
+    }
+
+    p1_str_word = (const CPU_INT32U *)p1_str;
+    p2_str_word = (const CPU_INT32U *)p2_str;
+    while ((p1_str_word         != (const CPU_INT32U *)0) &&
+           (p2_str_word         != (const CPU_INT32U *)0) &&
+           ((len_max - cmp_len) >= sizeof(CPU_INT32U))) {
+        word = *p1_str_word;
+        if ((word != *p2_str_word) ||                           /* Stop at non-identical word ...                       */
+            (STR_WORD_HAS_NUL(word))) {                         /* ... or word with NULL char.                          */
+            break;
+        }
+        if (((p1_str_word + 1) == (const CPU_INT32U *)0) ||     /* Stop before the NULL address (see Note #2).          */
+            ((p2_str_word + 1) == (const CPU_INT32U *)0)) {
+            break;
+        }
+        p1_str_word++;
+        p2_str_word++;
+        cmp_len += sizeof(CPU_INT32U);
+    }
+
+   *pp1_str = (const CPU_CHAR *)p1_str_word;
+   *pp2_str = (const CPU_CHAR *)p2_str_word;
+
+    return (cmp_len);
+}
+#endif
+
@@ -211,6 +211,24 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   STRING WORD ACCESS CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_WORD_EN to scan strings one 32-bit word at a time, rather than one
+*               character at a time, in Str_Len_N(), Str_Copy_N(), Str_Cat_N(), Str_Cmp_N() & Str_Char_N().
+*
+*               See also 'lib_str.c  Str_WordSkip()  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_STR_CFG_WORD_EN
+#define  LIB_STR_CFG_WORD_EN                    DEF_ENABLED
+                                                                /*   DEF_DISABLED     Octet-at-a-time str functions     */
+                                                                /*   DEF_ENABLED      Word-at-a-time  str functions     */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               DEFINES
@@ -234,6 +252,33 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                   COMPILED SEARCH STRING DATA TYPE
+*
+* Note(s) : (1) A search string compiled by Str_SrchPatInit() can be searched for by Str_SrchPat_N() in
+*               any number of strings, without re-computing its factorization & shift table.
+*
+*           (2) The search string itself is NOT copied & MUST remain valid while the compiled search string
+*               is in use.
+*
+*           (3) 'ShiftTbl[c]' is how far the search window may move when character 'c' is found at the
+*               window's last position, i.e. the distance from the last occurrence of 'c' in the search
+*               string to its end, OR the search string length if 'c' does not occur.  Shifts are limited
+*               to DEF_INT_08U_MAX_VAL, which only shortens the shift.
+*********************************************************************************************************
+*/
+
+                                                                /* --------------- COMPILED SRCH STR ------------------ */
+typedef  struct  str_srch_pat {
+    const  CPU_CHAR     *PatPtr;                                /* Ptr to srch str (see Note #2).                       */
+           CPU_SIZE_T    PatLen;                                /* Len of srch str.                                     */
+           CPU_SIZE_T    PatSuffixIx;                           /* Ix  of critical factorization's right half.          */
+           CPU_SIZE_T    PatPeriod;                             /* Period of srch str, or shift after a left half miss. */
+           CPU_BOOLEAN   PatPeriodic;                           /* Indicates whether srch str is periodic.              */
+           CPU_INT08U    ShiftTbl[DEF_INT_08U_MAX_VAL + 1u];    /* Shift per last window char (see Note #3).            */
+} STR_SRCH_PAT;
+
 
 /*
 *********************************************************************************************************
@@ -343,6 +388,13 @@ CPU_CHAR    *Str_Str_N          (const  CPU_CHAR      *pstr,
                                  const  CPU_CHAR      *pstr_srch,
                                         CPU_SIZE_T     len_max);
 
+CPU_BOOLEAN  Str_SrchPatInit    (       STR_SRCH_PAT  *ppat,
+                                 const  CPU_CHAR      *pstr_srch);
+
+CPU_CHAR    *Str_SrchPat_N      (const  STR_SRCH_PAT  *ppat,
+                                 const  CPU_CHAR      *pstr,
+                                        CPU_SIZE_T     len_max);
+
 
                                                                        /* ------------------ STR FMT  FNCTS ------------------ */
 CPU_CHAR    *Str_FmtNbr_Int32U  (       CPU_INT32U     nbr,
@@ -370,6 +422,11 @@ CPU_CHAR    *Str_FmtNbr_32      (       CPU_FP32       nbr,
                                         CPU_CHAR      *pstr);
 #endif
 
+CPU_CHAR    *Str_Fmt_N          (       CPU_CHAR      *pstr_dest,
+                                        CPU_SIZE_T     len_max,
+                                 const  CPU_CHAR      *pfmt,
+                                                       ...);
+
 
                                                                        /* ----------------- STR PARSE FNCTS ------------------ */
 CPU_INT32U   Str_ParseNbr_Int32U(const  CPU_CHAR      *pstr,
@@ -417,6 +474,14 @@ CPU_INT32S   Str_ParseNbr_Int32S(const  CPU_CHAR      *pstr,
 #endif
 
 
+#if    ((LIB_STR_CFG_WORD_EN != DEF_DISABLED) && \
+        (LIB_STR_CFG_WORD_EN != DEF_ENABLED ))
+#error  "LIB_STR_CFG_WORD_EN             illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -76,6 +76,34 @@ extern  "C" {
 
 #define  OS_TASK_SW_SYNC()      __asm__ __volatile__ ("isb" : : : "memory")
 
+
+/*
+*********************************************************************************************************
+*                                       EXCLUSIVE ACCESS (LDREX/STREX)
+*
+* Note(s) : (1) Used by the lock-free semaphore fast path (see OS_CFG_SEM_FAST_EN).  Only 32-bit words
+*               are supported.
+*
+*           (2) The Cortex-M4 clears its local exclusive monitor on every exception entry and return.  A
+*               sequence interrupted by an ISR or a context switch therefore fails its OS_CPU_STREX() and
+*               must be retried, which makes it safe against updates done inside critical sections.
+*
+*           (3) OS_CPU_STREX() sets 'res' to 0 if the store succeeded and to 1 if it must be retried.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_LDREX(p_word, val)        __asm__ __volatile__ ("ldrex %0, [%1]"                          \
+                                                                : "=r" (val)                             \
+                                                                : "r"  (p_word)                          \
+                                                                : "memory")
+
+#define  OS_CPU_STREX(p_word, val, res)   __asm__ __volatile__ ("strex %0, %2, [%1]"                      \
+                                                                : "=&r" (res)                            \
+                                                                : "r"   (p_word), "r" (val)              \
+                                                                : "memory")
+
+#define  OS_CPU_CLREX()                   __asm__ __volatile__ ("clrex" : : : "memory")
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -127,10 +155,51 @@ extern  "C" {
 *                   tick interrupt, then the CPU/system is most likely over-burdened & can't be expected
 *                   to handle all its interrupts/tasks. The system time reference gets compromised as a
 *                   result of losing tick interrupts.
+*
+*           (3) With a kernel aware boundary (CPU_CFG_KA_IPL_BOUNDARY > 0, see 'cpu_cfg.h'), the tick
+*               interrupt calls the kernel & is placed at the highest kernel aware priority.
 *********************************************************************************************************
 */
 
+#if      (CPU_CFG_KA_IPL_BOUNDARY > 0)
+#define  OS_CPU_CFG_SYSTICK_PRIO           CPU_CFG_KA_BASEPRI   /* See Note #3.                                      */
+#else
 #define  OS_CPU_CFG_SYSTICK_PRIO           0u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     TASK STACK GUARD CONFIGURATION
+*
+* Note(s) : (1) When OS_CPU_CFG_STK_GUARD_EN is enabled, every context switch programs MPU region
+*               OS_CPU_STK_GUARD_REGION as a no access region over the bottom of the incoming task's
+*               stack.  A stack overflow then raises a MemManage fault on the offending store, with
+*               'OSTCBCurPtr' still pointing to the task that overflowed.
+*
+*           (2) The region is OS_CPU_STK_GUARD_SIZE bytes, the smallest size the Cortex-M4 MPU supports,
+*               & MUST be aligned on its size.  The guard therefore starts at the first 32-byte boundary
+*               at or above 'StkBasePtr' & costs between 32 & 63 bytes of every task stack.
+*
+*           (3) The highest numbered region is used so that the guard overrides any region set up by the
+*               application.  The background map (PRIVDEFENA) covers the rest of the memory.
+*
+*           (4) OS_CPU_STK_GUARD_END() returns the first stack entry above the guard.  OSTaskStkChk()
+*               starts its scan there since reading the guard of the running task would fault.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_STK_GUARD_EN
+#define  OS_CPU_CFG_STK_GUARD_EN          DEF_ENABLED
+#endif
+
+#define  OS_CPU_STK_GUARD_REGION                 7u         /* See Note #3.                                           */
+#define  OS_CPU_STK_GUARD_SIZE                  32u         /* See Note #2.                                           */
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+#define  OS_CPU_STK_GUARD_END(p_stk_base)   ((CPU_STK *)(((CPU_ADDR)(p_stk_base) + (2u * OS_CPU_STK_GUARD_SIZE) - 1u) \
+                                                         & ~((CPU_ADDR)OS_CPU_STK_GUARD_SIZE - 1u)))
+#endif
 
 
 /*
@@ -158,6 +227,8 @@ void  OS_CPU_PendSVHandler (void);
 void  OS_CPU_SysTickHandler(void);
 void  OS_CPU_SysTickInit   (CPU_INT32U  cnts);
 
+void  OS_CPU_StkGuardSet   (void);
+
 #if (OS_CPU_ARM_FP_EN == DEF_ENABLED)
 void  OS_CPU_FP_Reg_Push   (CPU_STK    *stkPtr);
 void  OS_CPU_FP_Reg_Pop    (CPU_STK    *stkPtr);
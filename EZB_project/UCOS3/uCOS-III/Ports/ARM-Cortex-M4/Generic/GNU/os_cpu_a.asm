@@ -21,6 +21,13 @@
 @********************************************************************************************************
 @
 
+@********************************************************************************************************
+@                                           INCLUDE FILES
+@********************************************************************************************************
+
+#include  <cpu_cfg.h>
+
+
 @********************************************************************************************************
 @                                          PUBLIC FUNCTIONS
 @********************************************************************************************************
@@ -32,6 +39,7 @@
     .extern  OSTCBHighRdyPtr
     .extern  OSIntExit
     .extern  OSTaskSwHook
+    .extern  OS_CPU_StkGuardSet
     .extern  OS_CPU_ExceptStkBase
 
 
@@ -134,6 +142,8 @@ OS_CPU_FP_Reg_Pop:
 @              c) Set the main stack to OS_CPU_ExceptStkBase
 @              d) Trigger PendSV exception;
 @              e) Enable interrupts (tasks will run with interrupts enabled).
+@
+@           3) The stack guard of the first task is placed here since OSTaskSwHook() is not called for it.
 @********************************************************************************************************
 
 .thumb_func
@@ -151,6 +161,8 @@ OSStartHighRdy:
     LDR     R1, [R0]
     MSR     MSP, R1
 
+    BL      OS_CPU_StkGuardSet                                  @ Guard the stack of the first task (see Note #3)
+
     MOVW    R0, #:lower16:OSPrioCur                             @ OSPrioCur   = OSPrioHighRdy;
     MOVT    R0, #:upper16:OSPrioCur
     MOVW    R1, #:lower16:OSPrioHighRdy
@@ -245,11 +257,20 @@ OSIntCtxSw:
 @           4) Since PendSV is set to lowest priority in the system (by OSStartHighRdy() above), we
 @              know that it will only be run when no other exception or interrupt is active, and
 @              therefore safe to assume that context being switched out was using the process stack (PSP).
+@
+@           5) With a kernel aware boundary (CPU_CFG_KA_IPL_BOUNDARY > 0, see 'cpu_cfg.h'), only the
+@              kernel aware interrupts are masked during the switch, through BASEPRI, like in
+@              CPU_SR_Save().  BASEPRI is 0 on entry since PendSV has the lowest priority.
 @********************************************************************************************************
 
 .thumb_func
 OS_CPU_PendSVHandler:
+#if (CPU_CFG_KA_IPL_BOUNDARY > 0)
+    MOV     R2, #(CPU_CFG_KA_IPL_BOUNDARY << (8 - CPU_CFG_NVIC_PRIO_BITS))
+    MSR     BASEPRI, R2                                         @ Mask kernel aware ints only (see Note #5)
+#else
     CPSID   I                                                   @ Prevent interruption during context switch
+#endif
     MRS     R0, PSP                                             @ PSP is process stack pointer
     STMFD   R0!, {R4-R11}                                       @ Save remaining regs r4-11 on process stack
 
@@ -278,7 +299,12 @@ OS_CPU_PendSVHandler:
     LDR     R0, [R2]                                            @ R0 is new process SP; SP = OSTCBHighRdyPtr->StkPtr;
     LDMFD   R0!, {R4-R11}                                       @ Restore r4-11 from new process stack
     MSR     PSP, R0                                             @ Load PSP with new process SP
+#if (CPU_CFG_KA_IPL_BOUNDARY > 0)
+    MOV     R2, #0
+    MSR     BASEPRI, R2
+#else
     CPSIE   I
+#endif
     BX      LR                                                  @ Exception return will restore remaining context
 
 .end
@@ -100,6 +100,14 @@ void  OSInitHook (void)
                                                                     /* 8-byte align the ISR stack.                            */    
     OS_CPU_ExceptStkBase = (CPU_STK *)(OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize);
     OS_CPU_ExceptStkBase = (CPU_STK *)((CPU_STK)(OS_CPU_ExceptStkBase) & 0xFFFFFFF8);
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+                                                            /* Enable the MPU with the default memory map ...         */
+    CPU_REG_MPU_CTRL    = CPU_REG_MPU_CTRL_PRIVDEFENA | CPU_REG_MPU_CTRL_ENABLE;
+    CPU_REG_NVIC_SHCSR |= CPU_REG_NVIC_SHCSR_MEMFAULTENA;   /* ... & report guard hits as MemManage faults.           */
+    CPU_MB();
+    OS_TASK_SW_SYNC();
+#endif
 }
 
 
@@ -374,6 +382,10 @@ void  OSTaskSwHook (void)
     }
     OSSchedLockTimeMaxCur = (CPU_TS)0;                      /* Reset the per-task value                               */
 #endif
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+    OS_CPU_StkGuardSet();                                   /* Move the stack guard to the incoming task              */
+#endif
 }
 
 
@@ -461,6 +473,45 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 }
 
 
+/*
+*********************************************************************************************************
+*                                        SET TASK STACK GUARD
+*
+* Description: Place the MPU stack guard region at the bottom of the stack of the task about to run.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OSTaskSwHook() & by OSStartHighRdy() for the first task, with
+*                 interrupts disabled & 'OSTCBHighRdyPtr' pointing to the TCB of the task being switched in.
+*
+*              2) The cost is two MPU register writes.  Writing the base address with the VALID bit set
+*                 selects the region, so the region number register is not written.  No barrier is needed
+*                 since the exception return (or the ISB in OSStartHighRdy()) that resumes the task
+*                 synchronizes the new setting.
+*
+*              3) See 'os_cpu.h  TASK STACK GUARD CONFIGURATION'.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_StkGuardSet (void)
+{
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+    CPU_ADDR  guard;
+
+
+    guard                = ((CPU_ADDR)OSTCBHighRdyPtr->StkBasePtr + OS_CPU_STK_GUARD_SIZE - 1u)
+                         & ~((CPU_ADDR)OS_CPU_STK_GUARD_SIZE - 1u);
+    CPU_REG_MPU_REG_BASE = guard
+                         | CPU_REG_MPU_RBAR_VALID
+                         | OS_CPU_STK_GUARD_REGION;
+    CPU_REG_MPU_REG_ATTR = CPU_REG_MPU_RASR_XN
+                         | CPU_REG_MPU_RASR_AP_NONE
+                         | CPU_REG_MPU_RASR_SIZE_32B
+                         | CPU_REG_MPU_RASR_ENABLE;
+#endif
+}
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -164,7 +164,7 @@
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
 
 #define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u) || (OS_CFG_PEND_MULTI_EN > 0u) \
-                                   || (OS_CFG_ISR_POST_DEFERRED_EN > 0u)) ? 1u : 0u)
+                                   || (OS_CFG_ISR_POST_DEFERRED_EN > 0u) || (OS_CFG_WAIT_SET_EN > 0u)) ? 1u : 0u)
 
 
 /*
@@ -216,6 +216,9 @@
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_WAIT_SET             (OS_STATE)(  8u)  /* Pending on a wait set                              */
+#define  OS_TASK_PEND_ON_RWLOCK_RD            (OS_STATE)(  9u)  /* Pending on a reader-writer lock for reading        */
+#define  OS_TASK_PEND_ON_RWLOCK_WR            (OS_STATE)( 10u)  /* Pending on a reader-writer lock for writing        */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -239,11 +242,17 @@
 ========================================================================================================================
 */
 
+#define  OS_OBJ_TYPE_BUS                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('B', 'U', 'S', ' ')
 #define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
+#define  OS_OBJ_TYPE_DEFER_Q                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('D', 'E', 'F', 'Q')
 #define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
+#define  OS_OBJ_TYPE_MEM_SLAB                (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'L', 'A', 'B')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
+#define  OS_OBJ_TYPE_SCHED_TBL               (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'T', 'B', 'L')
+#define  OS_OBJ_TYPE_SEQLOCK                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'Q', 'L')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
 #define  OS_OBJ_TYPE_TASK_MSG                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'G')
 #define  OS_OBJ_TYPE_TASK_RESUME             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'R', 'E', 'S')
@@ -251,6 +260,8 @@
 #define  OS_OBJ_TYPE_TASK_SUSPEND            (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'U', 'S')
 #define  OS_OBJ_TYPE_TICK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'I', 'C', 'K')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_WAIT_SET                (OS_OBJ_TYPE)CPU_TYPE_CREATE('W', 'S', 'E', 'T')
+#define  OS_OBJ_TYPE_WORK_Q                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('W', 'R', 'K', 'Q')
 
 /*
 ========================================================================================================================
@@ -303,6 +314,15 @@
 #define  OS_OPT_PEND_ABORT_1                 (OS_OPT)(0x0000u)  /* Pend abort a single waiting task                   */
 #define  OS_OPT_PEND_ABORT_ALL               (OS_OPT)(0x0100u)  /* Pend abort ALL tasks waiting                       */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     MUTEX OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_MUTEX_NONE                   (OS_OPT)(0x0000u)  /* Priority inheritance (default)                     */
+#define  OS_OPT_MUTEX_CEILING                (OS_OPT)(0x0001u)  /* Immediate priority ceiling                         */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     POST OPTIONS
@@ -320,6 +340,10 @@
 #define  OS_OPT_POST_1                       (OS_OPT)(0x0000u)  /* Post message to highest priority task waiting      */
 #define  OS_OPT_POST_ALL                     (OS_OPT)(0x0200u)  /* Broadcast message to ALL tasks waiting             */
 
+#define  OS_OPT_POST_PRIO                    (OS_OPT)(0x0020u)  /* Message carries a priority, see OSQPostPrio()      */
+#define  OS_OPT_POST_PRIO_MASK               (OS_OPT)(0x7C00u)  /* ... held in these bits                             */
+#define  OS_OPT_POST_PRIO_SHIFT                          (10u)
+
 #define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
 
 /*
@@ -330,10 +354,13 @@
 
 #define  OS_OPT_TASK_NONE                    (OS_OPT)(0x0000u)  /* No option selected                                 */
 #define  OS_OPT_TASK_STK_CHK                 (OS_OPT)(0x0001u)  /* Enable stack checking for the task                 */
-#define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Clear the stack when the task is create            */
+#define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Fill the stack with OS_TASK_STK_FILL at creation    */
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
+#define  OS_TASK_STK_FILL               (CPU_STK)(0xA5A5A5A5u)  /* Pattern marking never used stack entries           */
+#define  OS_TASK_STK_CHK_WIN              (CPU_STK_SIZE)(32u)  /* Entries past the high-water mark read on each check */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -373,6 +400,23 @@
 #define  OS_OPT_TMR_CALLBACK                      (OS_OPT)(3u)  /* OSTmrStop() option to call 'callback' w/ timer arg */
 #define  OS_OPT_TMR_CALLBACK_ARG                  (OS_OPT)(4u)  /* OSTmrStop() option to call 'callback' w/ new   arg */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     BUS TOPICS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_BUS_TOPICS_ALL                   ((OS_FLAGS)(DEF_INT_32U_MAX_VAL >> (32u - OS_CFG_BUS_TOPIC_MAX)))
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  WORK QUEUE OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_WORK_Q_RR                         (OS_OPT)(0u)  /* Busy workers get items in turn                     */
+#define  OS_OPT_WORK_Q_LEAST_LOADED               (OS_OPT)(1u)  /* Busy workers get items by fewest queued items      */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIMER STATES
@@ -384,6 +428,25 @@
 #define  OS_TMR_STATE_RUNNING                   (OS_STATE)(2u)
 #define  OS_TMR_STATE_COMPLETED                 (OS_STATE)(3u)
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               SCHEDULE TABLE OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_SCHED_TBL_TICK                    (OS_OPT)(0u)  /* Table is ticked by OSTimeTick()                    */
+#define  OS_OPT_SCHED_TBL_EXT                     (OS_OPT)(1u)  /* Table is ticked by the app. with OSSchedTblTick()  */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                SCHEDULE TABLE STATES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_SCHED_TBL_STATE_UNUSED              (OS_STATE)(0u)
+#define  OS_SCHED_TBL_STATE_STOPPED             (OS_STATE)(1u)
+#define  OS_SCHED_TBL_STATE_RUNNING             (OS_STATE)(2u)
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                       PRIORITY
@@ -392,6 +455,35 @@
                                                                     /* Dflt prio to init task TCB                     */
 #define  OS_PRIO_INIT                       (OS_PRIO)(OS_CFG_PRIO_MAX)
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               SIZE-CLASS MEMORY (SLAB)
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_MEM_SLAB_BLK_SIZE_MIN_SHIFT                  4u     /* Smallest class holds 16 bytes                      */
+#define  OS_MEM_SLAB_BLK_SIZE_MIN           (1u << OS_MEM_SLAB_BLK_SIZE_MIN_SHIFT)
+#define  OS_MEM_SLAB_NBR_CLASS                           7u     /* 16, 32, 64, 128, 256, 512 and 1024 bytes           */
+#define  OS_MEM_SLAB_BLK_SIZE_MAX           (OS_MEM_SLAB_BLK_SIZE_MIN << (OS_MEM_SLAB_NBR_CLASS - 1u))
+
+                                                                    /* Storage (in bytes) needed by OSMemSlabCreate() */
+#define  OS_MEM_SLAB_SIZE(n16, n32, n64, n128, n256, n512, n1024)  \
+                                            (((n16)   *   16u) +     \
+                                             ((n32)   *   32u) +     \
+                                             ((n64)   *   64u) +     \
+                                             ((n128)  *  128u) +     \
+                                             ((n256)  *  256u) +     \
+                                             ((n512)  *  512u) +     \
+                                             ((n1024) * 1024u))
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               PER-TASK MEMORY MAGAZINES
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                    /* Blocks moved per refill or drain               */
+#define  OS_MEM_MAG_BATCH                   ((OS_CFG_MEM_MAG_SIZE + 1u) / 2u)
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                 TIMER TICK THRESHOLDS
@@ -426,6 +518,9 @@ typedef  enum  os_err {
     OS_ERR_ACCEPT_ISR                = 10001u,
 
     OS_ERR_B                         = 11000u,
+    OS_ERR_BUS_FULL                  = 11001u,
+    OS_ERR_BUS_MSG_FREE              = 11002u,
+    OS_ERR_BUS_TOPIC_INVALID         = 11003u,
 
     OS_ERR_C                         = 12000u,
     OS_ERR_CREATE_ISR                = 12001u,
@@ -433,7 +528,15 @@ typedef  enum  os_err {
     OS_ERR_D                         = 13000u,
     OS_ERR_DEL_ISR                   = 13001u,
 
+    OS_ERR_DEFER_Q_FULL              = 13101u,
+    OS_ERR_DEFER_Q_SIZE              = 13102u,
+
     OS_ERR_E                         = 14000u,
+    OS_ERR_EDF_ADMISSION             = 14001u,
+    OS_ERR_EDF_ISR                   = 14002u,
+    OS_ERR_EDF_NOT_SET               = 14003u,
+    OS_ERR_EDF_PRIO                  = 14004u,
+    OS_ERR_EDF_TIME_INVALID          = 14005u,
 
     OS_ERR_F                         = 15000u,
     OS_ERR_FATAL_RETURN              = 15001u,
@@ -474,6 +577,8 @@ typedef  enum  os_err {
     OS_ERR_MEM_INVALID_P_DATA        = 22208u,
     OS_ERR_MEM_INVALID_SIZE          = 22209u,
     OS_ERR_MEM_NO_FREE_BLKS          = 22210u,
+    OS_ERR_MEM_MAG_NOT_OWNER         = 22211u,
+    OS_ERR_MEM_MAG_ISR               = 22212u,
 
     OS_ERR_MSG_POOL_EMPTY            = 22301u,
     OS_ERR_MSG_POOL_NULL_PTR         = 22302u,
@@ -481,6 +586,7 @@ typedef  enum  os_err {
     OS_ERR_MUTEX_NOT_OWNER           = 22401u,
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
+    OS_ERR_MUTEX_CEILING             = 22404u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -521,11 +627,14 @@ typedef  enum  os_err {
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_PRIO_INVALID            = 26005u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
     OS_ERR_ROUND_ROBIN_1             = 27002u,
     OS_ERR_ROUND_ROBIN_DISABLED      = 27003u,
+    OS_ERR_RWLOCK_NOT_OWNER          = 27004u,
+    OS_ERR_RWLOCK_OWNER              = 27005u,
 
     OS_ERR_S                         = 28000u,
     OS_ERR_SCHED_INVALID_TIME_SLICE  = 28001u,
@@ -533,9 +642,15 @@ typedef  enum  os_err {
     OS_ERR_SCHED_LOCKED              = 28003u,
     OS_ERR_SCHED_NOT_LOCKED          = 28004u,
     OS_ERR_SCHED_UNLOCK_ISR          = 28005u,
+    OS_ERR_SCHED_TBL_ENTRY_INVALID   = 28006u,
+    OS_ERR_SCHED_TBL_ISR             = 28007u,
+    OS_ERR_SCHED_TBL_PERIOD_INVALID  = 28008u,
+    OS_ERR_SCHED_TBL_RUNNING         = 28009u,
+    OS_ERR_SCHED_TBL_STOPPED         = 28010u,
 
     OS_ERR_SEM_OVF                   = 28101u,
     OS_ERR_SET_ISR                   = 28102u,
+    OS_ERR_SEQLOCK_RETRY             = 28103u,
 
     OS_ERR_STAT_RESET_ISR            = 28201u,
     OS_ERR_STAT_PRIO_INVALID         = 28202u,
@@ -595,6 +710,7 @@ typedef  enum  os_err {
     OS_ERR_TIME_NOT_DLY              = 29308u,
     OS_ERR_TIME_SET_ISR              = 29309u,
     OS_ERR_TIME_ZERO_DLY             = 29310u,
+    OS_ERR_TIME_INVALID_MICROSECONDS = 29311u,
 
     OS_ERR_TIMEOUT                   = 29401u,
 
@@ -617,6 +733,10 @@ typedef  enum  os_err {
     OS_ERR_V                         = 31000u,
 
     OS_ERR_W                         = 32000u,
+    OS_ERR_WAIT_SET_MEMBER           = 32001u,
+    OS_ERR_WAIT_SET_NOT_MEMBER       = 32002u,
+
+    OS_ERR_WORK_Q_NO_WORKER          = 32101u,
 
     OS_ERR_X                         = 33000u,
 
@@ -638,6 +758,8 @@ typedef  enum  os_err {
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
 typedef  struct  os_mem              OS_MEM;
+typedef  struct  os_mem_slab         OS_MEM_SLAB;
+typedef  struct  os_mem_mag          OS_MEM_MAG;
 
 typedef  struct  os_msg              OS_MSG;
 typedef  struct  os_msg_pool         OS_MSG_POOL;
@@ -649,8 +771,16 @@ typedef  struct  os_int_q            OS_INT_Q;
 
 typedef  struct  os_q                OS_Q;
 
+typedef  struct  os_rwlock           OS_RWLOCK;
+
+typedef  struct  os_sched_tbl        OS_SCHED_TBL;
+typedef  struct  os_sched_tbl_entry  OS_SCHED_TBL_ENTRY;
+typedef  void                      (*OS_SCHED_TBL_FNCT)(void *p_arg);
+
 typedef  struct  os_sem              OS_SEM;
 
+typedef  struct  os_seqlock          OS_SEQLOCK;
+
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 typedef  struct  os_tcb              OS_TCB;
@@ -676,6 +806,21 @@ typedef  struct  os_pend_data        OS_PEND_DATA;
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
 
+typedef  struct  os_wait_set         OS_WAIT_SET;
+typedef  struct  os_wait_set_entry   OS_WAIT_SET_ENTRY;
+
+typedef  struct  os_work_q           OS_WORK_Q;
+typedef  struct  os_work_q_worker    OS_WORK_Q_WORKER;
+
+typedef  struct  os_bus              OS_BUS;
+typedef  struct  os_bus_msg          OS_BUS_MSG;
+typedef  struct  os_bus_sub          OS_BUS_SUB;
+typedef  void                      (*OS_BUS_FREE_PTR)(OS_BUS_MSG *p_msg);
+
+typedef  struct  os_defer_q          OS_DEFER_Q;
+typedef  struct  os_defer_item       OS_DEFER_ITEM;
+typedef  void                      (*OS_DEFER_FNCT)(void *p_arg);
+
 #if OS_CFG_APP_HOOKS_EN > 0u
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
 typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
@@ -839,6 +984,34 @@ struct os_mem {                                             /* MEMORY CONTROL BL
 };
 
 
+struct os_mem_slab {                                        /* SIZE-CLASS SLAB CONTROL BLOCK                          */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MEM_SLAB                  */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;
+#endif
+    void                *AddrPtr;                           /* Pointer to beginning of storage area                   */
+    void                *AddrEndPtr[OS_MEM_SLAB_NBR_CLASS]; /* End of the storage of each class (exclusive)           */
+    OS_MEM               Class[OS_MEM_SLAB_NBR_CLASS];      /* One partition per power-of-two block size              */
+    OS_MEM_QTY           NbrUsedMax[OS_MEM_SLAB_NBR_CLASS]; /* Peak number of blocks used in each class               */
+    OS_CTR               NbrFallbackCtr[OS_MEM_SLAB_NBR_CLASS]; /* Requests served from a larger class               */
+    OS_CTR               NbrFailCtr[OS_MEM_SLAB_NBR_CLASS]; /* Requests that could not be served at all               */
+};
+
+
+#if OS_CFG_MEM_MAG_EN > 0u
+struct os_mem_mag {                                         /* PER-TASK MAGAZINE (CACHE OF FREE BLOCKS)               */
+    OS_MEM              *MemPtr;                            /* Partition the cached blocks belong to                  */
+    OS_TCB              *TCBPtr;                            /* Only task allowed to use this magazine                 */
+    OS_MEM_QTY           NbrBlks;                           /* Number of blocks currently cached                      */
+    void                *BlkTbl[OS_CFG_MEM_MAG_SIZE];       /* Cached blocks, used as a LIFO                          */
+    OS_CTR               FillCtr;                           /* Number of refills from the partition                   */
+    OS_CTR               DrainCtr;                          /* Number of drains to the partition                      */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                       MESSAGES
@@ -850,6 +1023,9 @@ struct  os_msg {                                            /* MESSAGE CONTROL B
     void                *MsgPtr;                            /* Actual message                                         */
     OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
     CPU_TS               MsgTS;                             /* Time stamp of when message was sent                    */
+#if OS_CFG_Q_PRIO_EN > 0u
+    OS_PRIO              MsgPrio;                           /* Priority of the message (0 is the highest)             */
+#endif
 };
 
 
@@ -874,6 +1050,10 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if OS_CFG_DBG_EN > 0u
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if OS_CFG_Q_PRIO_EN > 0u
+    CPU_DATA             PrioTbl;                           /* Bit 'n' set when priority 'n' holds messages           */
+    OS_MSG              *PrioTailPtr[OS_CFG_Q_PRIO_LEVELS]; /* Last message of each priority                          */
+#endif
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
     CPU_INT32U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -907,6 +1087,10 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
     CPU_TS               TS;
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    OS_OPT               Opt;                               /* OS_OPT_MUTEX_NONE or OS_OPT_MUTEX_CEILING              */
+    OS_PRIO              PrioCeil;                          /* Priority the owner runs at when Opt is CEILING         */
+#endif
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
     CPU_INT08U           MutexID;                           /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -937,12 +1121,108 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if OS_CFG_WAIT_SET_EN > 0u
+    OS_WAIT_SET_ENTRY   *WaitSetEntryPtr;                   /* Registration in a wait set, if any                     */
+#endif
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
     CPU_INT08U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 READER-WRITER LOCKS
+*
+* Note(s) : See  PEND OBJ  Note #1'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rwlock {                                         /* Reader-Writer Lock                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of readers and writers waiting on the lock        */
+#if OS_CFG_DBG_EN > 0u
+    OS_RWLOCK           *DbgPrevPtr;
+    OS_RWLOCK           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_RWLOCK           *RWLockGrpNextPtr;                  /* Next lock owned by the same writer                     */
+    OS_TCB              *OwnerTCBPtr;                       /* Writer holding the lock, NULL if none                  */
+    OS_OBJ_QTY           RdCtr;                             /* Number of readers holding the lock                     */
+    OS_OBJ_QTY           WrWaitCtr;                         /* Number of writers in the pend list                     */
+    CPU_TS               TS;                                /* Timestamp of when the lock was last released           */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   SCHEDULE TABLES
+*
+* Note(s) : (1) The application fills in the first members of each entry; the kernel maintains the others.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_sched_tbl_entry {                                /* Schedule Table Entry                                   */
+                                                            /* --------------- SET BY THE APPLICATION --------------- */
+    OS_TICK              Offset;                            /* Activation time in the cycle                           */
+    OS_TCB              *TCBPtr;                            /* Task to signal at each activation, or ...              */
+    OS_SCHED_TBL_FNCT    FnctPtr;                           /* ... function to call from the ISR ticking the table    */
+    void                *FnctArg;                           /* Argument passed to the function                        */
+    OS_TICK              Budget;                            /* Ticks for a task, CPU_TS units for a function, 0 = off */
+                                                            /* ------------------ SET BY THE KERNEL ----------------- */
+    CPU_BOOLEAN          Busy;                              /* Task activated & not waiting for the next activation   */
+    OS_TICK              Elapsed;                           /* Ticks since the task was activated                     */
+    OS_CTR               ActCtr;                            /* Number of activations                                  */
+    OS_CTR               OverrunCtr;                        /* Number of times the budget was exceeded                */
+    OS_CTR               SkipCtr;                           /* Activations dropped because the task was still busy    */
+};
+
+
+struct  os_sched_tbl {                                      /* Schedule Table (cyclic executive)                      */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SCHED_TBL                 */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Table Name (NUL terminated ASCII)           */
+#endif
+    OS_SCHED_TBL_ENTRY  *EntryTbl;                          /* Entries, sorted by offset                              */
+    OS_OBJ_QTY           NbrEntries;                        /* Number of entries                                      */
+    OS_OBJ_QTY           EntryIx;                           /* Index of the next entry to activate                    */
+    OS_TICK              Period;                            /* Length of one cycle, in table ticks                    */
+    OS_TICK              Time;                              /* Current time in the cycle                              */
+    OS_OPT               Opt;                               /* Options (see OS_OPT_SCHED_TBL_xxx)                     */
+    OS_STATE             State;
+    OS_SCHED_TBL        *NextPtr;                           /* List of running tables ticked by OSTimeTick()          */
+    OS_CTR               CycleCtr;                          /* Number of cycles completed                             */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    SEQUENCE LOCKS
+*
+* Note(s) : (1) Protects a record with one writer and lock-free readers.  See 'os_seqlock.c'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_seqlock {                                        /* Sequence Lock                                          */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SEQLOCK                   */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    OS_SEQ_CTR           Seq;                               /* Odd while the record is being written                  */
+};
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      SEMAPHORES
@@ -968,6 +1248,9 @@ struct  os_sem {                                            /* Semaphore
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_SEM_CTR           Ctr;
     CPU_TS               TS;
+#if OS_CFG_WAIT_SET_EN > 0u
+    OS_WAIT_SET_ENTRY   *WaitSetEntryPtr;                   /* Registration in a wait set, if any                     */
+#endif
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
     CPU_INT08U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -977,91 +1260,69 @@ struct  os_sem {                                            /* Semaphore
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  TASK CONTROL BLOCK
+*
+* Note(s) : (1) 'StkPtr' MUST remain the first field: the context switch code in the port accesses it at offset 0.
+*
+*           (2) The fields are grouped by how often the kernel touches them.  The fields read or written on every
+*               context switch, scheduling decision, tick and pend/post come first, so that they stay within reach of
+*               the short (16-bit) Thumb load/store encodings (bytes within 32, half-words within 64 and words within
+*               128 bytes of the TCB address).  Statistics, stack checking and debug fields, which are compiled out
+*               with their configuration options, come last.
+*
+*           (3) Byte and half-word fields are kept next to each other so that the structure has no padding holes.
+*               New fields should be added to the matching group with the same care.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
 struct os_tcb {
-    CPU_STK             *StkPtr;                            /* Pointer to current top of stack                        */
-
-    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
-
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
-    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
-#endif
+    CPU_STK             *StkPtr;                            /* Pointer to current top of stack (see Note #1)          */
 
+                                                            /* SCHEDULING ------------------------------------------- */
     OS_TCB              *NextPtr;                           /* Pointer to next     TCB in the TCB list                */
     OS_TCB              *PrevPtr;                           /* Pointer to previous TCB in the TCB list                */
-
-    OS_TCB              *TickNextPtr;
-    OS_TCB              *TickPrevPtr;
-
-    OS_TICK_LIST        *TickListPtr;                       /* Pointer to tick list if task is in a tick list         */
-
-#if OS_CFG_DBG_EN > 0u
-    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
-#endif
-
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
-    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
-#endif
-
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-    OS_TLS               TLS_Tbl[OS_CFG_TLS_TBL_SIZE];
-#endif
-
-#if OS_CFG_DBG_EN > 0u
-    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
-    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
-#endif
-
-    OS_PEND_DATA        *PendDataTblPtr;                    /* Pointer to list containing objects pended on           */
+    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
+    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
-
-    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
-    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
-#if OS_CFG_MUTEX_EN > 0u
+    OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_RWLOCK_EN > 0u)
     OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
-    OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
-#endif
-
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
-    CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
 #endif
-    OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
-
-    OS_OBJ_QTY           PendDataTblEntries;                /* Size of array of objects to pend on                    */
-
-    CPU_TS               TS;                                /* Timestamp                                              */
-#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
-    CPU_INT08U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
+#if OS_CFG_TASK_SUSPEND_EN > 0u
+    OS_NESTING_CTR       SuspendCtr;                        /* Nesting counter for OSTaskSuspend()                    */
 #endif
-    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
 
-                                                            /* DELAY / TIMEOUT                                        */
+                                                            /* DELAY / TIMEOUT -------------------------------------- */
+    OS_TICK_LIST        *TickListPtr;                       /* Pointer to tick list if task is in a tick list         */
+    OS_TCB              *TickNextPtr;
+    OS_TCB              *TickPrevPtr;
     OS_TICK              TickRemain;                        /* Number of ticks remaining (updated at by OS_TickTask() */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if OS_CFG_TIME_HR_EN > 0u
+    CPU_TS_TMR           TickHrTimeout;                     /* Timeout of next blocking pend, in CPU_TS timer counts  */
+#endif
 
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
     OS_TICK              TimeQuanta;
     OS_TICK              TimeQuantaCtr;
 #endif
 
+                                                            /* PEND / POST ------------------------------------------ */
+    OS_PEND_DATA        *PendDataTblPtr;                    /* Pointer to list containing objects pended on           */
+    OS_OBJ_QTY           PendDataTblEntries;                /* Size of array of objects to pend on                    */
 #if OS_MSG_EN > 0u
-    void                *MsgPtr;                            /* Message received                                       */
     OS_MSG_SIZE          MsgSize;
+    void                *MsgPtr;                            /* Message received                                       */
 #endif
+    CPU_TS               TS;                                /* Timestamp                                              */
+    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
 
-#if OS_CFG_TASK_Q_EN > 0u
-    OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
-#if OS_CFG_TASK_PROFILE_EN > 0u
-    CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
-    CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
-#endif
+#if OS_CFG_MUTEX_EN > 0u
+    OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
 #endif
 
-#if OS_CFG_TASK_REG_TBL_SIZE > 0u
-    OS_REG               RegTbl[OS_CFG_TASK_REG_TBL_SIZE];  /* Task specific registers                                */
+#if OS_CFG_RWLOCK_EN > 0u
+    OS_RWLOCK           *RWLockGrpHeadPtr;                  /* Reader-writer locks owned for writing                  */
 #endif
 
 #if OS_CFG_FLAG_EN > 0u
@@ -1070,10 +1331,31 @@ struct os_tcb {
     OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
 #endif
 
-#if OS_CFG_TASK_SUSPEND_EN > 0u
-    OS_NESTING_CTR       SuspendCtr;                        /* Nesting counter for OSTaskSuspend()                    */
+#if OS_CFG_SCHED_EDF_EN > 0u                                /* EARLIEST DEADLINE FIRST                                */
+    OS_TICK              EDFPeriod;                         /* Period, 0 if the task is not in the EDF class          */
+    OS_TICK              EDFDeadlineRel;                    /* Deadline relative to the release of a job              */
+    OS_TICK              EDFRelease;                        /* Release time of the current job                        */
+    OS_TICK              EDFDeadline;                       /* Absolute deadline of the current job                   */
+    OS_CPU_USAGE         EDFUtil;                           /* Utilization reserved at admission (0.01% units)        */
+    CPU_BOOLEAN          EDFJobLate;                        /* Current job already counted as a deadline miss         */
+    OS_CTR               EDFMissCtr;                        /* Number of deadlines missed                             */
+#endif
+
+#if OS_CFG_TASK_Q_EN > 0u
+    OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
+#endif
+
+#if OS_CFG_TASK_REG_TBL_SIZE > 0u
+    OS_REG               RegTbl[OS_CFG_TASK_REG_TBL_SIZE];  /* Task specific registers                                */
+#endif
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS               TLS_Tbl[OS_CFG_TLS_TBL_SIZE];
 #endif
 
+    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+
+                                                            /* STATISTICS ------------------------------------------- */
 #if OS_CFG_TASK_PROFILE_EN > 0u
     OS_CPU_USAGE         CPUUsage;                          /* CPU Usage of task (0.00-100.00%)                       */
     OS_CPU_USAGE         CPUUsageMax;                       /* CPU Usage of task (0.00-100.00%) - Peak                */
@@ -1085,11 +1367,10 @@ struct os_tcb {
 
     CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
+#if OS_CFG_TASK_Q_EN > 0u
+    CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
+    CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
 #endif
-
-#if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
-    CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
-    CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
 #endif
 
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
@@ -1099,12 +1380,30 @@ struct os_tcb {
     CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
 #endif
 
+                                                            /* STACK ------------------------------------------------ */
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
+    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
+    CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
+#endif
+
+#if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
+    CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
+    CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
+    CPU_STK             *StkHighWaterPtr;                   /* Deepest stack element known to have been used          */
+#endif
+
+                                                            /* DEBUG ------------------------------------------------ */
 #if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
+    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
+    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
     OS_TCB              *DbgPrevPtr;
     OS_TCB              *DbgNextPtr;
     CPU_CHAR            *DbgNamePtr;
 #endif
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+    CPU_INT08U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
     CPU_INT08U           TaskID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
 };
@@ -1155,30 +1454,218 @@ struct  os_tmr {
 
 
 /*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                           G L O B A L   V A R I A B L E S
-************************************************************************************************************************
-************************************************************************************************************************
+------------------------------------------------------------------------------------------------------------------------
+*                                                      WAIT SETS
+*
+* Note(s) : (1) A wait set is a pend object (see  PEND OBJ  Note #1).  Semaphores and message queues are registered
+*               once through an OS_WAIT_SET_ENTRY supplied by the caller.  A post that finds no task pending on the
+*               object itself appends the entry to the set's ready list (or hands the post directly to a task pending
+*               on the set), so OSWaitSetPend() never scans the registered objects.
+------------------------------------------------------------------------------------------------------------------------
 */
 
-#if OS_CFG_APP_HOOKS_EN > 0u
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;    /* Application hooks                          */
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
-
-OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
+struct  os_wait_set {                                       /* Wait Set                                               */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_WAIT_SET                  */
 #endif
-
-                                                                        /* IDLE TASK -------------------------------- */
-OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
-OS_EXT            OS_TCB                    OSIdleTaskTCB;
-
-                                                                        /* MISCELLANEOUS ---------------------------- */
-OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Wait Set Name (NUL terminated ASCII)        */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on the set                       */
+#if OS_CFG_DBG_EN > 0u
+    void                *DbgPrevPtr;
+    void                *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_WAIT_SET_ENTRY   *RdyHeadPtr;                        /* Registered objects that have been posted ...           */
+    OS_WAIT_SET_ENTRY   *RdyTailPtr;                        /* ... in the order they became ready                     */
+    OS_OBJ_QTY           NbrEntries;                        /* Number of registered objects                           */
+};
+
+
+struct  os_wait_set_entry {
+    OS_WAIT_SET         *SetPtr;                            /* Set the object is registered in                        */
+    OS_PEND_OBJ         *ObjPtr;                            /* Registered semaphore or message queue                  */
+    OS_WAIT_SET_ENTRY   *RdyNextPtr;                        /* Link in the set's ready list                           */
+    CPU_BOOLEAN          RdyFlag;                           /* DEF_TRUE while in the set's ready list                 */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     WORK QUEUES
+*
+* Note(s) : (1) Each worker owns a local queue of items and a semaphore it sleeps on while idle.  See 'os_work_q.c'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_work_q {                                         /* Work Queue                                             */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_WORK_Q                    */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Work Queue Name (NUL terminated ASCII)      */
+#endif
+    OS_WORK_Q_WORKER    *WorkerListPtr;                     /* List of workers                                        */
+    OS_WORK_Q_WORKER    *WorkerNextPtr;                     /* Worker whose turn is next                              */
+    OS_OBJ_QTY           NbrWorkers;                        /* Number of workers                                      */
+    OS_OPT               Opt;                               /* Options (see OS_OPT_WORK_Q_xxx)                        */
+    OS_CTR               PostCtr;                           /* Number of items posted                                 */
+};
+
+
+struct  os_work_q_worker {                                  /* Work Queue Worker                                      */
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Worker Name (NUL terminated ASCII)          */
+#endif
+    OS_WORK_Q           *WorkQPtr;                          /* Work queue the worker belongs to                       */
+    OS_WORK_Q_WORKER    *NextPtr;                           /* Next worker of the work queue                          */
+    OS_MSG_Q             MsgQ;                              /* Items queued for this worker                           */
+    OS_SEM               Sem;                               /* Signaled when an item is given to the idle worker      */
+    CPU_BOOLEAN          Idle;                              /* Worker waits on .Sem for an item                       */
+    OS_CTR               ItemCtr;                           /* Number of items processed                              */
+    OS_CTR               StealCtr;                          /* ... of which stolen from other workers                 */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                PUBLISH/SUBSCRIBE BUSES
+*
+* Note(s) : (1) A message published on a bus starts with an OS_BUS_MSG and is shared, not copied, by its subscribers.
+*               See 'os_bus.c'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_bus {                                            /* Bus                                                    */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_BUS                       */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Bus Name (NUL terminated ASCII)             */
+#endif
+    OS_BUS_FREE_PTR      FreePtr;                           /* Frees a message once every subscriber released it      */
+    OS_BUS_SUB          *SubTbl[OS_CFG_BUS_SUB_MAX];        /* Subscribers, by slot                                   */
+    CPU_DATA             TopicSubTbl[OS_CFG_BUS_TOPIC_MAX]; /* Bitmap of the subscriber slots of each topic           */
+    OS_OBJ_QTY           NbrSubs;                           /* Number of subscribers                                  */
+    OS_CTR               PubCtr;                            /* Number of messages published                           */
+};
+
+
+struct  os_bus_msg {                                        /* Bus Message header                                     */
+    OS_BUS              *BusPtr;                            /* Bus the message was published on                       */
+    OS_FLAGS             Topics;                            /* Topics the message was published to                    */
+    OS_OBJ_QTY           RefCtr;                            /* Number of subscribers yet to release the message       */
+};
+
+
+struct  os_bus_sub {                                        /* Bus Subscriber                                         */
+    OS_BUS              *BusPtr;                            /* Bus subscribed to                                      */
+    OS_FLAGS             Topics;                            /* Topics subscribed to                                   */
+    OS_Q                 Q;                                 /* Messages queued for this subscriber                    */
+    OS_CTR               DropCtr;                           /* Number of messages lost, queue full                    */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 DEFERRED WORK QUEUES
+*
+* Note(s) : (1) ISRs post function calls that the worker task of the queue makes.  See 'os_defer_q.c'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_defer_item {                                     /* Deferred Work Queue Item                               */
+    OS_DEFER_FNCT        FnctPtr;                           /* Function to call, NULL while the entry is not posted   */
+    void                *FnctArg;                           /* Argument passed to the function                        */
+};
+
+
+struct  os_defer_q {                                        /* Deferred Work Queue                                    */
+#if OS_OBJ_TYPE_REQ > 0u
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_DEFER_Q                   */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR            *NamePtr;                           /* Pointer to Queue Name (NUL terminated ASCII)           */
+#endif
+    OS_DEFER_ITEM       *ItemTbl;                           /* Ring of items                                          */
+    CPU_INT32U           ItemTblMask;                       /* Number of items in the ring - 1                        */
+    CPU_INT32U           InIx;                              /* Free-running index of the next entry to reserve        */
+    CPU_INT32U           OutIx;                             /* Free-running index of the next entry to run            */
+    OS_TCB              *TCBPtr;                            /* Worker task                                            */
+    OS_CTR               RunCtr;                            /* Number of items run                                    */
+    OS_CTR               OvfCtr;                            /* Number of items lost, ring full                        */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                              STATICALLY DEFINED OBJECTS
+*
+* Note(s) : (1) OS_SEM_DEFINE() and OS_Q_DEFINE() define a semaphore or a message queue in the state OSSemCreate() or
+*               OSQCreate() would leave it in.  The object is ready at reset, before OSInit(), and costs nothing at
+*               startup, e.g.:
+*
+*                   OS_Q_DEFINE(AppQ, "App Queue", 8u);
+*
+*           (2) Such an object is not in the debug lists and not counted in OSSemQty/OSQQty, so it must never be
+*               deleted.
+*
+*           (3) Tasks and memory partitions still need OSTaskCreate() and OSMemCreate(): the stack frame of a task and
+*               the free list of a partition are built inside the storage given by the application.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_OBJ_TYPE_REQ > 0u
+#define  OS_OBJ_TYPE_INIT(type)              .Type = (type),
+#else
+#define  OS_OBJ_TYPE_INIT(type)
+#endif
+
+#if OS_CFG_DBG_EN > 0u
+#define  OS_OBJ_NAME_INIT(p_name)            .NamePtr = (CPU_CHAR *)(p_name), .DbgNamePtr = (CPU_CHAR *)" ",
+#else
+#define  OS_OBJ_NAME_INIT(p_name)
+#endif
+
+#define  OS_SEM_DEFINE(sem, p_name, cnt)                                                                               \
+         OS_SEM  sem = { OS_OBJ_TYPE_INIT(OS_OBJ_TYPE_SEM)                                                             \
+                         OS_OBJ_NAME_INIT(p_name)                                                                      \
+                         .Ctr = (OS_SEM_CTR)(cnt) }
+
+#define  OS_Q_DEFINE(q, p_name, max_qty)                                                                               \
+         OS_Q    q   = { OS_OBJ_TYPE_INIT(OS_OBJ_TYPE_Q)                                                               \
+                         OS_OBJ_NAME_INIT(p_name)                                                                      \
+                         .MsgQ = { .NbrEntriesSize = (OS_MSG_QTY)(max_qty) } }
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                           G L O B A L   V A R I A B L E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;    /* Application hooks                          */
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
+
+OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
+#endif
+
+                                                                        /* IDLE TASK -------------------------------- */
+OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
+OS_EXT            OS_TCB                    OSIdleTaskTCB;
+
+                                                                        /* MISCELLANEOUS ---------------------------- */
+OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
 #endif
@@ -1260,6 +1747,13 @@ OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
 OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
+#endif
+#if OS_CFG_SCHED_EDF_EN > 0u
+OS_EXT            OS_CPU_USAGE              OSSchedEDFUtil;             /* Utilization admitted in the EDF class      */
+OS_EXT            OS_CTR                    OSSchedEDFMissCtr;          /* Deadlines missed by EDF tasks              */
+#endif
+#if OS_CFG_SCHED_TBL_EN > 0u
+OS_EXT            OS_SCHED_TBL             *OSSchedTblListPtr;          /* Running tables ticked by OSTimeTick()      */
 #endif
                                                                         /* SEMAPHORES ------------------------------- */
 #if OS_CFG_SEM_EN > 0u
@@ -1280,6 +1774,10 @@ OS_EXT            OS_TICK                   OSStatTaskCtrRun;
 OS_EXT            CPU_BOOLEAN               OSStatTaskRdy;
 OS_EXT            OS_TCB                    OSStatTaskTCB;
 OS_EXT            CPU_TS                    OSStatTaskTimeMax;
+#if OS_CFG_SEQLOCK_EN > 0u
+OS_EXT            OS_SEQLOCK                OSStatSeqLock;              /* Guards OSStatTaskCPUUsage... & CtrRun      */
+OS_EXT            CPU_BOOLEAN               OSStatTaskCPUUsageMaxRst;   /* Stat task to clear OSStatTaskCPUUsageMax   */
+#endif
 #endif
 
                                                                         /* TASKS ------------------------------------ */
@@ -1299,6 +1797,13 @@ OS_EXT            OS_TCB                    OSTickTaskTCB;
 OS_EXT            CPU_TS                    OSTickTaskTimeMax;
 OS_EXT            OS_TICK_LIST              OSTickListDly;
 OS_EXT            OS_TICK_LIST              OSTickListTimeout;
+#if OS_CFG_TICK_DIRECT_EN > 0u
+OS_EXT            OS_TICK                   OSTickFallbackCtr;          /* Ticks not processed in the tick ISR        */
+#endif
+#if OS_CFG_TIME_HR_EN > 0u
+OS_EXT            OS_TICK_LIST              OSTickListHr;               /* Tasks waiting on the high-res. timer       */
+OS_EXT            CPU_TS_TMR                OSTickHrTs;                 /* Timer count the list deltas start from     */
+#endif
 
 
 
@@ -1498,6 +2003,38 @@ void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_MEM_SLAB_EN > 0u
+void          OSMemSlabCreate           (OS_MEM_SLAB           *p_slab,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_addr,
+                                         OS_MEM_QTY      const *p_nbr_blks_tbl,
+                                         OS_ERR                *p_err);
+
+void         *OSMemSlabGet              (OS_MEM_SLAB           *p_slab,
+                                         OS_MEM_SIZE            size,
+                                         OS_ERR                *p_err);
+
+void          OSMemSlabPut              (OS_MEM_SLAB           *p_slab,
+                                         void                  *p_blk,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_MEM_MAG_EN > 0u
+void          OSMemMagCreate            (OS_MEM_MAG            *p_mag,
+                                         OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void         *OSMemMagGet               (OS_MEM_MAG            *p_mag,
+                                         OS_ERR                *p_err);
+
+void          OSMemMagPut               (OS_MEM_MAG            *p_mag,
+                                         void                  *p_blk,
+                                         OS_ERR                *p_err);
+
+void          OSMemMagFlush             (OS_MEM_MAG            *p_mag,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if OS_CFG_DBG_EN > 0u
@@ -1506,6 +2043,17 @@ void          OS_MemDbgListAdd          (OS_MEM                *p_mem);
 
 void          OS_MemInit                (OS_ERR                *p_err);
 
+#if OS_CFG_MEM_SLAB_EN > 0u
+CPU_INT08U    OS_MemSlabClassGet        (OS_MEM_SIZE            size);
+#endif
+
+#if OS_CFG_MEM_MAG_EN > 0u
+void          OS_MemMagDrain            (OS_MEM_MAG            *p_mag,
+                                         OS_MEM_QTY             nbr_blks);
+
+void          OS_MemMagFill             (OS_MEM_MAG            *p_mag);
+#endif
+
 #endif
 
 
@@ -1519,6 +2067,14 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+void          OSMutexCreateExt          (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio_ceil,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if OS_CFG_MUTEX_DEL_EN > 0u
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1552,104 +2108,282 @@ void          OS_MutexDbgListAdd        (OS_MUTEX              *p_mutex);
 void          OS_MutexDbgListRemove     (OS_MUTEX              *p_mutex);
 #endif
 
-void          OS_MutexInit              (OS_ERR                *p_err);
-#endif
+void          OS_MutexInit              (OS_ERR                *p_err);
+#endif
+
+void          OS_MutexGrpAdd            (OS_TCB                *p_tcb,
+                                         OS_MUTEX              *p_mutex);
+
+void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
+                                         OS_MUTEX              *p_mutex);
+
+OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
+
+void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
+
+
+/* ================================================================================================================== */
+/*                                                    MULTI PEND                                                      */
+/* ================================================================================================================== */
+
+#if OS_CFG_PEND_MULTI_EN > 0u
+
+OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+OS_OBJ_QTY    OS_PendMultiGetRdy        (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size);
+
+CPU_BOOLEAN   OS_PendMultiValidate      (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size);
+
+void          OS_PendMultiWait          (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout);
+#endif
+
+#if OS_CFG_WAIT_SET_EN > 0u
+
+void          OSWaitSetAdd              (OS_WAIT_SET           *p_set,
+                                         OS_WAIT_SET_ENTRY     *p_entry,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_ERR                *p_err);
+
+void          OSWaitSetCreate           (OS_WAIT_SET           *p_set,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+OS_PEND_OBJ  *OSWaitSetPend             (OS_WAIT_SET           *p_set,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         void                 **p_msg,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSWaitSetRemove           (OS_WAIT_SET_ENTRY     *p_entry,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_WaitSetEntryRemove     (OS_WAIT_SET_ENTRY     *p_entry);
+
+OS_PEND_OBJ  *OS_WaitSetGetRdy          (OS_WAIT_SET           *p_set,
+                                         void                 **p_msg,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts);
+
+CPU_BOOLEAN   OS_WaitSetObjGet          (OS_PEND_OBJ           *p_obj,
+                                         void                 **p_msg,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts);
+
+CPU_BOOLEAN   OS_WaitSetObjRdy          (OS_PEND_OBJ           *p_obj);
+
+void          OS_WaitSetRdyAppend       (OS_WAIT_SET_ENTRY     *p_entry);
+
+void          OS_WaitSetSignal          (OS_WAIT_SET_ENTRY     *p_entry);
+#endif
+
+/* ================================================================================================================== */
+/*                                                   MESSAGE QUEUES                                                   */
+/* ================================================================================================================== */
+
+#if OS_CFG_Q_EN > 0u
+
+void          OSQCreate                 (OS_Q                  *p_q,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_Q_DEL_EN > 0u
+OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_Q_FLUSH_EN > 0u
+OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
+                                         OS_ERR                *p_err);
+#endif
+
+void         *OSQPend                   (OS_Q                  *p_q,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_Q_PRIO_EN > 0u
+void          OSQPostPrio               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_Q_PEND_ABORT_EN > 0u
+OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSQPost                   (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_QClr                   (OS_Q                  *p_q);
+
+#if OS_CFG_DBG_EN > 0u
+void          OS_QDbgListAdd            (OS_Q                  *p_q);
+
+void          OS_QDbgListRemove         (OS_Q                  *p_q);
+#endif
+
+void          OS_QInit                  (OS_ERR                *p_err);
+
+void          OS_QPost                  (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 READER-WRITER LOCKS                                                */
+/* ================================================================================================================== */
+
+#if OS_CFG_RWLOCK_EN > 0u
+
+void          OSRWLockCreate            (OS_RWLOCK             *p_rwlock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_RWLOCK_DEL_EN > 0u
+OS_OBJ_QTY    OSRWLockDel               (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRWLockPendRd            (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPendWr            (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPostRd            (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 
-void          OS_MutexGrpAdd            (OS_TCB                *p_tcb,
-                                         OS_MUTEX              *p_mutex);
+void          OSRWLockPostWr            (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 
-void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
-                                         OS_MUTEX              *p_mutex);
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
+void          OS_RWLockGrant            (OS_RWLOCK             *p_rwlock,
+                                         CPU_TS                 ts);
 
-void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
+void          OS_RWLockGrpAdd           (OS_TCB                *p_tcb,
+                                         OS_RWLOCK             *p_rwlock);
 
+void          OS_RWLockGrpPostAll       (OS_TCB                *p_tcb);
 
-/* ================================================================================================================== */
-/*                                                    MULTI PEND                                                      */
-/* ================================================================================================================== */
+OS_PRIO       OS_RWLockGrpPrioFindHighest(OS_TCB               *p_tcb);
 
-#if OS_CFG_PEND_MULTI_EN > 0u
+void          OS_RWLockGrpRemove        (OS_TCB                *p_tcb,
+                                         OS_RWLOCK             *p_rwlock);
 
-OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
-                                         OS_OBJ_QTY             tbl_size,
+void          OS_RWLockPend             (OS_RWLOCK             *p_rwlock,
                                          OS_TICK                timeout,
                                          OS_OPT                 opt,
+                                         OS_STATE               mode,
+                                         CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
-/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+void          OS_RWLockPost             (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_STATE               mode,
+                                         OS_ERR                *p_err);
 
-OS_OBJ_QTY    OS_PendMultiGetRdy        (OS_PEND_DATA          *p_pend_data_tbl,
-                                         OS_OBJ_QTY             tbl_size);
+void          OS_RWLockPendRemove       (OS_TCB                *p_tcb);
 
-CPU_BOOLEAN   OS_PendMultiValidate      (OS_PEND_DATA          *p_pend_data_tbl,
-                                         OS_OBJ_QTY             tbl_size);
+OS_PRIO       OS_RWLockPrioFind         (OS_TCB                *p_tcb);
 
-void          OS_PendMultiWait          (OS_PEND_DATA          *p_pend_data_tbl,
-                                         OS_OBJ_QTY             tbl_size,
-                                         OS_TICK                timeout);
+void          OS_RWLockPrioRestore      (OS_TCB                *p_tcb);
+
+OS_PEND_DATA *OS_RWLockWrWaitGet        (OS_RWLOCK             *p_rwlock);
 #endif
 
+
 /* ================================================================================================================== */
-/*                                                   MESSAGE QUEUES                                                   */
+/*                                                   SCHEDULE TABLES                                                  */
 /* ================================================================================================================== */
 
-#if OS_CFG_Q_EN > 0u
-
-void          OSQCreate                 (OS_Q                  *p_q,
+#if OS_CFG_SCHED_TBL_EN > 0u
+void          OSSchedTblCreate          (OS_SCHED_TBL          *p_tbl,
                                          CPU_CHAR              *p_name,
-                                         OS_MSG_QTY             max_qty,
-                                         OS_ERR                *p_err);
-
-#if OS_CFG_Q_DEL_EN > 0u
-OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
+                                         OS_SCHED_TBL_ENTRY    *p_entry_tbl,
+                                         OS_OBJ_QTY             nbr_entries,
+                                         OS_TICK                period,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
-#endif
-
-#if OS_CFG_Q_FLUSH_EN > 0u
-OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
-                                         OS_ERR                *p_err);
-#endif
 
-void         *OSQPend                   (OS_Q                  *p_q,
-                                         OS_TICK                timeout,
-                                         OS_OPT                 opt,
-                                         OS_MSG_SIZE           *p_msg_size,
-                                         CPU_TS                *p_ts,
+void          OSSchedTblStart           (OS_SCHED_TBL          *p_tbl,
                                          OS_ERR                *p_err);
 
-#if OS_CFG_Q_PEND_ABORT_EN > 0u
-OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
-                                         OS_OPT                 opt,
+void          OSSchedTblStop            (OS_SCHED_TBL          *p_tbl,
                                          OS_ERR                *p_err);
-#endif
 
-void          OSQPost                   (OS_Q                  *p_q,
-                                         void                  *p_void,
-                                         OS_MSG_SIZE            msg_size,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+void          OSSchedTblTick            (OS_SCHED_TBL          *p_tbl);
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-void          OS_QClr                   (OS_Q                  *p_q);
+void          OS_SchedTblUpdate         (void);
+#endif
 
-#if OS_CFG_DBG_EN > 0u
-void          OS_QDbgListAdd            (OS_Q                  *p_q);
 
-void          OS_QDbgListRemove         (OS_Q                  *p_q);
-#endif
+/* ================================================================================================================== */
+/*                                                   SEQUENCE LOCKS                                                   */
+/* ================================================================================================================== */
 
-void          OS_QInit                  (OS_ERR                *p_err);
+#if OS_CFG_SEQLOCK_EN > 0u
+void          OSSeqLockCreate           (OS_SEQLOCK            *p_lock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
 
-void          OS_QPost                  (OS_Q                  *p_q,
-                                         void                  *p_void,
-                                         OS_MSG_SIZE            msg_size,
-                                         OS_OPT                 opt,
-                                         CPU_TS                 ts,
+OS_SEQ_CTR    OSSeqLockRdBegin          (OS_SEQLOCK            *p_lock);
+
+CPU_BOOLEAN   OSSeqLockRdRetry          (OS_SEQLOCK            *p_lock,
+                                         OS_SEQ_CTR             seq);
+
+void          OSSeqLockRead             (OS_SEQLOCK            *p_lock,
+                                         void                  *p_dst,
+                                         void                  *p_src,
+                                         CPU_SIZE_T             size,
                                          OS_ERR                *p_err);
+
+void          OSSeqLockWrBegin          (OS_SEQLOCK            *p_lock);
+
+void          OSSeqLockWrEnd            (OS_SEQLOCK            *p_lock);
 #endif
 
 
@@ -1704,10 +2438,20 @@ void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 
 void          OS_SemInit                (OS_ERR                *p_err);
 
+#if OS_CFG_SEM_FAST_EN > 0u
+CPU_BOOLEAN   OS_SemPendFast            (OS_SEM                *p_sem,
+                                         OS_SEM_CTR            *p_ctr);
+#endif
+
 OS_SEM_CTR    OS_SemPost                (OS_SEM                *p_sem,
                                          OS_OPT                 opt,
                                          CPU_TS                 ts,
                                          OS_ERR                *p_err);
+
+#if OS_CFG_SEM_FAST_EN > 0u
+CPU_BOOLEAN   OS_SemPostFast            (OS_SEM                *p_sem,
+                                         OS_SEM_CTR            *p_ctr);
+#endif
 #endif
 
 
@@ -1815,6 +2559,16 @@ void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+void          OSTaskEDFSet              (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_TICK                deadline,
+                                         OS_TICK                budget,
+                                         OS_ERR                *p_err);
+
+void          OSTaskEDFPeriodWait       (OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_TaskBlock              (OS_TCB                *p_tcb,
@@ -1909,6 +2663,20 @@ void          OSTimeDlyResume           (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_TIME_HR_EN > 0u
+void          OSTimeDlyCycles           (CPU_TS_TMR             cycles,
+                                         OS_ERR                *p_err);
+
+void          OSTimeDlyUs               (CPU_INT32U             us,
+                                         OS_ERR                *p_err);
+
+void          OSTimeTimeoutSetCycles    (CPU_TS_TMR             cycles,
+                                         OS_ERR                *p_err);
+
+void          OSTimeTimeoutSetUs        (CPU_INT32U             us,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
 
 void          OSTimeSet                 (OS_TICK                ticks,
@@ -1916,6 +2684,10 @@ void          OSTimeSet                 (OS_TICK                ticks,
 
 void          OSTimeTick                (void);
 
+#if OS_CFG_TIME_HR_EN > 0u
+void          OSTimeTickHr              (void);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TIMER MANAGEMENT                                                   */
@@ -1972,6 +2744,104 @@ void          OS_TmrTask                (void                  *p_arg);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                PUBLISH/SUBSCRIBE BUSES                                             */
+/* ================================================================================================================== */
+
+#if OS_CFG_BUS_EN > 0u
+void          OSBusCreate               (OS_BUS                *p_bus,
+                                         CPU_CHAR              *p_name,
+                                         OS_BUS_FREE_PTR        p_free,
+                                         OS_ERR                *p_err);
+
+void          OSBusMsgRelease           (OS_BUS_MSG            *p_msg,
+                                         OS_ERR                *p_err);
+
+OS_BUS_MSG   *OSBusPend                 (OS_BUS_SUB            *p_sub,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSBusPublish              (OS_BUS                *p_bus,
+                                         OS_BUS_MSG            *p_msg,
+                                         OS_FLAGS               topics,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSBusSubscribe            (OS_BUS                *p_bus,
+                                         OS_BUS_SUB            *p_sub,
+                                         CPU_CHAR              *p_name,
+                                         OS_FLAGS               topics,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                DEFERRED WORK QUEUES                                                */
+/* ================================================================================================================== */
+
+#if OS_CFG_DEFER_Q_EN > 0u
+void          OSDeferQCreate            (OS_DEFER_Q            *p_dq,
+                                         CPU_CHAR              *p_name,
+                                         OS_DEFER_ITEM         *p_item_tbl,
+                                         OS_OBJ_QTY             nbr_items,
+                                         OS_TCB                *p_tcb,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_ERR                *p_err);
+
+void          OSDeferQPost              (OS_DEFER_Q            *p_dq,
+                                         OS_DEFER_FNCT          p_fnct,
+                                         void                  *p_arg,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_DeferQTask             (void                  *p_arg);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                     WORK QUEUES                                                    */
+/* ================================================================================================================== */
+
+#if OS_CFG_WORK_Q_EN > 0u
+void          OSWorkQCreate             (OS_WORK_Q             *p_wq,
+                                         CPU_CHAR              *p_name,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void         *OSWorkQPend               (OS_WORK_Q_WORKER      *p_worker,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         OS_ERR                *p_err);
+
+void          OSWorkQPost               (OS_WORK_Q             *p_wq,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSWorkQWorkerAdd          (OS_WORK_Q             *p_wq,
+                                         OS_WORK_Q_WORKER      *p_worker,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+OS_WORK_Q_WORKER  *OS_WorkQWorkerMostLoaded  (OS_WORK_Q        *p_wq);
+
+OS_WORK_Q_WORKER  *OS_WorkQWorkerSel         (OS_WORK_Q        *p_wq);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                    MISCELLANEOUS                                                   */
 /* ================================================================================================================== */
@@ -2059,6 +2929,10 @@ void          OSTaskSwHook              (void);
 
 void          OSTimeTickHook            (void);
 
+#if OS_CFG_TIME_HR_EN > 0u                                  /* Provided by the BSP, see os_tick.c                     */
+void          OS_TickHrTmrSet           (CPU_TS_TMR             cycles);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -2177,6 +3051,15 @@ void          OS_SchedLockTimeMeasStop  (void);
 void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list);
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+void          OS_EDFRdyListInsert       (OS_TCB                *p_tcb,
+                                         CPU_BOOLEAN            head);
+
+void          OS_EDFMissChk             (OS_TCB                *p_tcb);
+
+void          OS_EDFRemove              (OS_TCB                *p_tcb);
+#endif
+
 /* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
 
 void          OS_RdyListInit            (void);
@@ -2237,6 +3120,17 @@ void          OS_TickListRemove         (OS_TCB                *p_tcb);
 
 void          OS_TickListResetPeak      (void);
 
+#if OS_CFG_TICK_DIRECT_EN > 0u
+CPU_BOOLEAN   OS_TickUpdateDirect       (void);
+#endif
+
+#if OS_CFG_TIME_HR_EN > 0u
+void          OS_TickListInsertHr       (OS_TCB                *p_tcb,
+                                         CPU_TS_TMR             cycles);
+
+void          OS_TickListUpdateHr       (void);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -2285,6 +3179,14 @@ void          OS_TickListResetPeak      (void);
 #error  "OS_CFG.H, Missing OS_CFG_PEND_MULTI_EN: Enable (1) or Disable (0) multi-pend feature"
 #endif
 
+#ifndef OS_CFG_WAIT_SET_EN
+#error  "OS_CFG.H, Missing OS_CFG_WAIT_SET_EN: Enable (1) or Disable (0) wait sets (OSWaitSetXXX())"
+#else
+    #if    (OS_CFG_WAIT_SET_EN > 0u) && (OS_CFG_SEM_EN == 0u) && (OS_CFG_Q_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_WAIT_SET_EN requires OS_CFG_SEM_EN and/or OS_CFG_Q_EN"
+    #endif
+#endif
+
 
 #if     OS_CFG_PRIO_MAX < 8u
 #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be >= 8"
@@ -2306,6 +3208,48 @@ void          OS_TickListResetPeak      (void);
 #endif
 
 
+#ifndef OS_CFG_SCHED_EDF_EN
+#error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_EN: Include code for Earliest Deadline First Scheduling"
+#else
+    #if OS_CFG_SCHED_EDF_EN > 0u
+        #ifndef OS_CFG_SCHED_EDF_PRIO
+        #error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_PRIO: Priority level scheduled Earliest Deadline First"
+        #endif
+        #if    (OS_CFG_SCHED_EDF_PRIO == 0u) || \
+               (OS_CFG_SCHED_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+        #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_PRIO must be between 1 and OS_CFG_PRIO_MAX - 2"
+        #endif
+
+        #ifndef OS_CFG_SCHED_EDF_UTIL_MAX
+        #error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_UTIL_MAX: EDF admission bound"
+        #endif
+        #if     OS_CFG_SCHED_EDF_UTIL_MAX > 10000u
+        #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_UTIL_MAX must be <= 10000 (100.00%)"
+        #endif
+    #endif
+#endif
+
+
+#ifndef OS_CFG_SCHED_TBL_EN
+#error  "OS_CFG.H, Missing OS_CFG_SCHED_TBL_EN: Include code for Schedule Tables"
+#endif
+
+
+#ifndef OS_CFG_SEQLOCK_EN
+#error  "OS_CFG.H, Missing OS_CFG_SEQLOCK_EN: Include code for Sequence Locks"
+#else
+    #if    (OS_CFG_SEQLOCK_EN > 0u)
+        #ifndef OS_CFG_SEQLOCK_RD_RETRY_MAX
+        #error  "OS_CFG.H, Missing OS_CFG_SEQLOCK_RD_RETRY_MAX: Number of attempts of OSSeqLockRead()"
+        #else
+            #if    (OS_CFG_SEQLOCK_RD_RETRY_MAX == 0u)
+            #error  "OS_CFG.H,         OS_CFG_SEQLOCK_RD_RETRY_MAX must be > 0"
+            #endif
+        #endif
+    #endif
+#endif
+
+
 #ifndef OS_CFG_STK_SIZE_MIN
 #error  "OS_CFG.H, Missing OS_CFG_STK_SIZE_MIN: Determines the minimum size for a task stack"
 #endif
@@ -2349,6 +3293,20 @@ void          OS_TickListResetPeak      (void);
 
 #ifndef OS_CFG_MEM_EN
 #error  "OS_CFG.H, Missing OS_CFG_MEM_EN: Enable (1) or Disable (0) code generation for MEMORY MANAGER"
+#else
+    #ifndef OS_CFG_MEM_SLAB_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MEM_SLAB_EN: Include code for OSMemSlabXXX()"
+    #endif
+
+    #ifndef OS_CFG_MEM_MAG_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MEM_MAG_EN: Include code for OSMemMagXXX()"
+    #else
+        #if     OS_CFG_MEM_MAG_EN > 0u
+            #if     OS_CFG_MEM_MAG_SIZE < 2u
+            #error  "OS_CFG.H,         OS_CFG_MEM_MAG_SIZE must be >= 2"
+            #endif
+        #endif
+    #endif
 #endif
 
 /*
@@ -2367,6 +3325,10 @@ void          OS_TickListResetPeak      (void);
     #ifndef OS_CFG_MUTEX_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PEND_ABORT_EN: Include code for OSMutexPendAbort()"
     #endif
+
+    #ifndef OS_CFG_MUTEX_CEILING_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MUTEX_CEILING_EN: Include code for OSMutexCreateExt() and priority-ceiling mutexes"
+    #endif
 #endif
 
 /*
@@ -2389,6 +3351,34 @@ void          OS_TickListResetPeak      (void);
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #ifndef OS_CFG_Q_PRIO_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_PRIO_EN: Include code for OSQPostPrio()"
+    #else
+        #if OS_CFG_Q_PRIO_EN > 0u
+            #ifndef OS_CFG_Q_PRIO_LEVELS
+            #error  "OS_CFG.H, Missing OS_CFG_Q_PRIO_LEVELS: Number of message priorities"
+            #endif
+            #if    (OS_CFG_Q_PRIO_LEVELS == 0u) || \
+                   (OS_CFG_Q_PRIO_LEVELS >  32u)
+            #error  "OS_CFG.H,         OS_CFG_Q_PRIO_LEVELS must be between 1 and 32"
+            #endif
+        #endif
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 READER-WRITER LOCKS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_RWLOCK_EN
+#error  "OS_CFG.H, Missing OS_CFG_RWLOCK_EN: Enable (1) or Disable (0) code generation for reader-writer locks"
+#else
+    #ifndef OS_CFG_RWLOCK_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_DEL_EN: Include code for OSRWLockDel()"
+    #endif
 #endif
 
 /*
@@ -2411,6 +3401,16 @@ void          OS_TickListResetPeak      (void);
     #ifndef OS_CFG_SEM_SET_EN
     #error  "OS_CFG.H, Missing OS_CFG_SEM_SET_EN: Include code for OSSemSet()"
     #endif
+
+    #ifndef OS_CFG_SEM_FAST_EN
+    #error  "OS_CFG.H, Missing OS_CFG_SEM_FAST_EN: Enable (1) or Disable (0) the lock-free OSSemPend()/OSSemPost() fast path"
+    #else
+        #if    (OS_CFG_SEM_FAST_EN > 0u) && !defined(OS_CPU_LDREX)
+        #error  "OS_CFG.H, OS_CFG_SEM_FAST_EN requires a port that provides OS_CPU_LDREX()/OS_CPU_STREX()"
+        #elif  (OS_CFG_SEM_FAST_EN > 0u) && (OS_SEM_CTR_SIZE != CPU_WORD_SIZE_32)
+        #error  "OS_CFG.H, OS_CFG_SEM_FAST_EN requires a 32-bit OS_SEM_CTR (see os_type.h)"
+        #endif
+    #endif
 #endif
 
 /*
@@ -2473,6 +3473,35 @@ void          OS_TickListResetPeak      (void);
 #error  "OS_CFG.H, Missing OS_CFG_TIME_DLY_RESUME_EN: Include code for OSTimeDlyResume()"
 #endif
 
+#ifndef OS_CFG_TIME_HR_EN
+#error  "OS_CFG.H, Missing OS_CFG_TIME_HR_EN: Include code for OSTimeDlyCycles() and OSTimeDlyUs()"
+#else
+    #if    (OS_CFG_TIME_HR_EN > 0u) && (CPU_CFG_TS_TMR_EN != DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_TIME_HR_EN requires the CPU timestamp timer (CPU_CFG_TS_TMR_EN)"
+    #endif
+    #if    (OS_CFG_TIME_HR_EN > 0u) && (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    #error  "OS_CFG.H,         OS_CFG_TIME_HR_EN cannot be used with OS_CFG_ISR_POST_DEFERRED_EN"
+    #endif
+#endif
+
+
+#ifndef OS_CFG_TICK_DIRECT_EN
+#error  "OS_CFG.H, Missing OS_CFG_TICK_DIRECT_EN: Process ticks in the tick ISR when few tasks become ready"
+#else
+    #if    (OS_CFG_TICK_DIRECT_EN > 0u)
+        #ifndef OS_CFG_TICK_DIRECT_BUDGET
+        #error  "OS_CFG.H, Missing OS_CFG_TICK_DIRECT_BUDGET: Maximum number of tasks readied by the tick ISR"
+        #else
+            #if    (OS_CFG_TICK_DIRECT_BUDGET == 0u)
+            #error  "OS_CFG.H,         OS_CFG_TICK_DIRECT_BUDGET must be > 0"
+            #endif
+        #endif
+        #if    (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+        #error  "OS_CFG.H,         OS_CFG_TICK_DIRECT_EN cannot be used with OS_CFG_ISR_POST_DEFERRED_EN"
+        #endif
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIMER MANAGEMENT
@@ -2487,6 +3516,58 @@ void          OS_TickListResetPeak      (void);
     #endif
 #endif
 
+/*
+************************************************************************************************************************
+*                                                DEFERRED WORK QUEUES
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_DEFER_Q_EN
+#error  "OS_CFG.H, Missing OS_CFG_DEFER_Q_EN: Enable (1) or Disable (0) deferred work queues (OSDeferQXXX())"
+#endif
+
+/*
+************************************************************************************************************************
+*                                                PUBLISH/SUBSCRIBE BUSES
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_BUS_EN
+#error  "OS_CFG.H, Missing OS_CFG_BUS_EN: Enable (1) or Disable (0) publish/subscribe buses (OSBusXXX())"
+#else
+    #if    (OS_CFG_BUS_EN > 0u) && (OS_CFG_Q_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_BUS_EN requires OS_CFG_Q_EN"
+    #endif
+    #ifndef OS_CFG_BUS_SUB_MAX
+    #error  "OS_CFG.H, Missing OS_CFG_BUS_SUB_MAX: Maximum number of subscribers per bus"
+    #else
+        #if    (OS_CFG_BUS_SUB_MAX < 1u) || (OS_CFG_BUS_SUB_MAX > DEF_INT_CPU_NBR_BITS)
+        #error  "OS_CFG.H, OS_CFG_BUS_SUB_MAX must be between 1 and DEF_INT_CPU_NBR_BITS"
+        #endif
+    #endif
+    #ifndef OS_CFG_BUS_TOPIC_MAX
+    #error  "OS_CFG.H, Missing OS_CFG_BUS_TOPIC_MAX: Number of topics per bus"
+    #else
+        #if    (OS_CFG_BUS_TOPIC_MAX < 1u) || (OS_CFG_BUS_TOPIC_MAX > DEF_INT_CPU_NBR_BITS)
+        #error  "OS_CFG.H, OS_CFG_BUS_TOPIC_MAX must be between 1 and DEF_INT_CPU_NBR_BITS"
+        #endif
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                     WORK QUEUES
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_WORK_Q_EN
+#error  "OS_CFG.H, Missing OS_CFG_WORK_Q_EN: Enable (1) or Disable (0) work queues (OSWorkQXXX())"
+#else
+    #if    (OS_CFG_WORK_Q_EN > 0u) && ((OS_CFG_SEM_EN == 0u) || (OS_MSG_EN == 0u))
+    #error  "OS_CFG.H, OS_CFG_WORK_Q_EN requires OS_CFG_SEM_EN and OS_CFG_Q_EN or OS_CFG_TASK_Q_EN"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                             LIBRARY CONFIGURATION ERRORS
@@ -0,0 +1,507 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                              PUBLISH/SUBSCRIBE EVENT BUS
+*
+* File    : OS_BUS.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A bus delivers messages by topic.  Each subscriber owns a message queue and registers a mask of the
+*               topics it wants; a message is published to a mask of topics and reaches every subscriber of any of
+*               them.
+*
+*           (2) For each topic, the bus keeps a bitmap of its subscribers, so a publish only visits the subscribers
+*               that match: the cost is one count-leading-zeros per matching subscriber, whatever the number of
+*               subscribers or topics.
+*
+*           (3) A message is not copied.  The same message is queued to every matching subscriber, all in one
+*               critical section, and counts one reference per subscriber it was queued to.  Each subscriber calls
+*               OSBusMsgRelease() when done with it; the last release returns the message through the function given
+*               to OSBusCreate().
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_bus__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_BUS_EN > 0u
+/*
+************************************************************************************************************************
+*                                                     CREATE A BUS
+*
+* Description: This function creates a publish/subscribe bus without subscribers.
+*
+* Arguments  : p_bus         is a pointer to the bus to create.
+*
+*              p_name        is a pointer to an ASCII string used to name the bus.
+*
+*              p_free        is a pointer to the function that frees a message once every subscriber released it,
+*                            or once published to no subscriber.  It is called by the task releasing the message.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_CREATE_ISR                 if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to create the bus after you called
+*                                                                  OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_bus' or 'p_free' is a NULL pointer
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSBusCreate (OS_BUS           *p_bus,
+                   CPU_CHAR         *p_name,
+                   OS_BUS_FREE_PTR   p_free,
+                   OS_ERR           *p_err)
+{
+    OS_OBJ_QTY  i;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_bus  == (OS_BUS         *)0) ||                  /* Validate arguments                                     */
+        (p_free == (OS_BUS_FREE_PTR )0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_bus->Type      = OS_OBJ_TYPE_BUS;                     /* Mark the data structure as a bus                       */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_bus->NamePtr   = p_name;
+#else
+    (void)&p_name;
+#endif
+    p_bus->FreePtr   = p_free;
+    for (i = 0u; i < OS_CFG_BUS_SUB_MAX; i++) {
+        p_bus->SubTbl[i] = (OS_BUS_SUB *)0;
+    }
+    for (i = 0u; i < OS_CFG_BUS_TOPIC_MAX; i++) {
+        p_bus->TopicSubTbl[i] = (CPU_DATA)0;
+    }
+    p_bus->NbrSubs   = (OS_OBJ_QTY)0;
+    p_bus->PubCtr    = (OS_CTR    )0;
+   *p_err            = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE A MESSAGE RECEIVED FROM A BUS
+*
+* Description: This function is called by a subscriber when it is done with a message received with OSBusPend().  The
+*              message is freed when its last subscriber releases it.
+*
+* Arguments  : p_msg         is a pointer to the message.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              if the call was successful
+*                                OS_ERR_OBJ_PTR_NULL      if 'p_msg' is a NULL pointer
+*                                OS_ERR_BUS_MSG_FREE      if the message holds no reference (released too often)
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSBusMsgRelease (OS_BUS_MSG  *p_msg,
+                       OS_ERR      *p_err)
+{
+    OS_OBJ_QTY  ref_ctr;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_msg == (OS_BUS_MSG *)0) {                         /* Validate 'p_msg'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    ref_ctr = p_msg->RefCtr;
+    if (ref_ctr == (OS_OBJ_QTY)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_BUS_MSG_FREE;
+        return;
+    }
+    ref_ctr--;
+    p_msg->RefCtr = ref_ctr;
+    CPU_CRITICAL_EXIT();
+
+    if (ref_ctr == (OS_OBJ_QTY)0) {                         /* Last reference: give the message back                  */
+        (*p_msg->BusPtr->FreePtr)(p_msg);
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              WAIT FOR A MESSAGE FROM A BUS
+*
+* Description: This function waits for the next message published to a topic of the subscriber.
+*
+* Arguments  : p_sub         is a pointer to the subscriber.
+*
+*              timeout, opt, p_msg_size, p_ts, p_err     are as for OSQPend() on the queue of the subscriber.
+*
+* Returns    : != (OS_BUS_MSG *)0  is a pointer to the message received, to release with OSBusMsgRelease()
+*              == (OS_BUS_MSG *)0  if no message was received (see 'p_err')
+************************************************************************************************************************
+*/
+
+OS_BUS_MSG  *OSBusPend (OS_BUS_SUB   *p_sub,
+                        OS_TICK       timeout,
+                        OS_OPT        opt,
+                        OS_MSG_SIZE  *p_msg_size,
+                        CPU_TS       *p_ts,
+                        OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_BUS_MSG *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_sub == (OS_BUS_SUB *)0) {                         /* Validate 'p_sub'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_BUS_MSG *)0);
+    }
+#endif
+
+    return ((OS_BUS_MSG *)OSQPend(&p_sub->Q,
+                                   timeout,
+                                   opt,
+                                   p_msg_size,
+                                   p_ts,
+                                   p_err));
+}
+
+
+/*
+************************************************************************************************************************
+*                                               PUBLISH A MESSAGE ON A BUS
+*
+* Description: This function queues a message to every subscriber of any of the topics in 'topics' (see Note #2 and #3
+*              at the top of this file).
+*
+* Arguments  : p_bus         is a pointer to the bus.
+*
+*              p_msg         is a pointer to the message.  Its OS_BUS_MSG header is filled in by this function.
+*
+*              topics        is the mask of topics the message is published to.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed on the queue of each subscriber:
+*
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO)
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 The message was queued to every matching subscriber,
+*                                                            if any
+*                                OS_ERR_BUS_TOPIC_INVALID    If 'topics' is 0 or holds topics above
+*                                                            OS_CFG_BUS_TOPIC_MAX
+*                                OS_ERR_OBJ_PTR_NULL         If 'p_bus' or 'p_msg' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE             If 'p_bus' is not a bus
+*                                OS_ERR_OPT_INVALID          If 'opt' is not valid
+*                                OS_ERR_POST_ISR             If you called this function from an ISR
+*                                OS_ERR_Q_MAX                If the queue of at least one subscriber was full (see
+*                                                            .DropCtr of the subscribers)
+*
+* Returns    : None
+*
+* Note(s)    : 1) Unless the arguments are invalid, the message belongs to the bus after this call, even if it was
+*                 dropped: it is freed right away if it could not be queued to any subscriber.
+************************************************************************************************************************
+*/
+
+void  OSBusPublish (OS_BUS       *p_bus,
+                    OS_BUS_MSG   *p_msg,
+                    OS_FLAGS      topics,
+                    OS_MSG_SIZE   msg_size,
+                    OS_OPT        opt,
+                    OS_ERR       *p_err)
+{
+    CPU_DATA     subs;
+    CPU_DATA     ix;
+    OS_FLAGS     topics_rem;
+    OS_BUS_SUB  *p_sub;
+    OS_OBJ_QTY   ref_ctr;
+    OS_ERR       err;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_bus == (OS_BUS     *)0) ||                       /* Validate arguments                                     */
+        (p_msg == (OS_BUS_MSG *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((topics                        == (OS_FLAGS)0) ||
+        ((topics & ~OS_BUS_TOPICS_ALL) != (OS_FLAGS)0)) {
+       *p_err = OS_ERR_BUS_TOPIC_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_bus->Type != OS_OBJ_TYPE_BUS) {                   /* Make sure bus was created                              */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    ts            = OS_TS_GET();                            /* Get timestamp                                          */
+    p_msg->BusPtr = p_bus;
+    p_msg->Topics = topics;
+    ref_ctr       = (OS_OBJ_QTY)0;
+   *p_err         = OS_ERR_NONE;
+
+    OS_CRITICAL_ENTER();
+    subs       = (CPU_DATA)0;                               /* Subscribers of any of the topics                       */
+    topics_rem = topics;
+    while (topics_rem != (OS_FLAGS)0) {
+        ix          = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)topics_rem);
+        subs       |= p_bus->TopicSubTbl[ix];
+        topics_rem &= (OS_FLAGS)~(OS_FLAGS)DEF_BIT(ix);
+    }
+
+    while (subs != (CPU_DATA)0) {                           /* Queue the message to each of them                      */
+        ix     = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros(subs);
+        subs  &= ~(CPU_DATA)DEF_BIT(ix);
+        p_sub  = p_bus->SubTbl[ix];
+        OS_QPost(&p_sub->Q,
+                  (void *)p_msg,
+                  msg_size,
+                  opt | OS_OPT_POST_NO_SCHED,
+                  ts,
+                 &err);
+        if (err == OS_ERR_NONE) {
+            ref_ctr++;
+        } else {
+            p_sub->DropCtr++;                               /* Queue full or no OS_MSG left                           */
+           *p_err = err;
+        }
+    }
+    p_msg->RefCtr = ref_ctr;                                /* Subscribers cannot run before the end of the section   */
+    p_bus->PubCtr++;
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    if (ref_ctr == (OS_OBJ_QTY)0) {                         /* Nobody to receive it                                   */
+        (*p_bus->FreePtr)(p_msg);
+        return;
+    }
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+        OSSched();                                          /* One scheduling point for all the subscribers           */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               SUBSCRIBE TO TOPICS OF A BUS
+*
+* Description: This function adds a subscriber to a bus.  The subscriber task then calls OSBusPend() with 'p_sub' to
+*              receive the messages published to any of 'topics'.
+*
+* Arguments  : p_bus         is a pointer to the bus.
+*
+*              p_sub         is a pointer to the subscriber to add.
+*
+*              p_name        is a pointer to an ASCII string used to name the subscriber (and its queue).
+*
+*              topics        is the mask of topics the subscriber wants.
+*
+*              max_qty       is the maximum number of messages queued for the subscriber.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_BUS_FULL                   if the bus already has OS_CFG_BUS_SUB_MAX subscribers
+*                                OS_ERR_BUS_TOPIC_INVALID          if 'topics' holds topics above OS_CFG_BUS_TOPIC_MAX
+*                                OS_ERR_CREATE_ISR                 if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to subscribe after you called
+*                                                                  OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_bus' or 'p_sub' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                   if 'p_bus' is not a bus
+*                                OS_ERR_Q_SIZE                     if 'max_qty' is 0
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSBusSubscribe (OS_BUS      *p_bus,
+                      OS_BUS_SUB  *p_sub,
+                      CPU_CHAR    *p_name,
+                      OS_FLAGS     topics,
+                      OS_MSG_QTY   max_qty,
+                      OS_ERR      *p_err)
+{
+    OS_OBJ_QTY  ix;
+    CPU_DATA    topic;
+    OS_FLAGS    topics_rem;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_bus == (OS_BUS     *)0) ||                       /* Validate arguments                                     */
+        (p_sub == (OS_BUS_SUB *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((topics & ~OS_BUS_TOPICS_ALL) != (OS_FLAGS)0) {
+       *p_err = OS_ERR_BUS_TOPIC_INVALID;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_bus->Type != OS_OBJ_TYPE_BUS) {                   /* Make sure bus was created                              */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_bus->NbrSubs >= OS_CFG_BUS_SUB_MAX) {
+       *p_err = OS_ERR_BUS_FULL;
+        return;
+    }
+
+    OSQCreate(&p_sub->Q,                                    /* Queue of the messages for this subscriber              */
+               p_name,
+               max_qty,
+               p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    p_sub->BusPtr  = p_bus;
+    p_sub->Topics  = topics;
+    p_sub->DropCtr = (OS_CTR)0;
+
+    CPU_CRITICAL_ENTER();
+    ix = 0u;
+    while (p_bus->SubTbl[ix] != (OS_BUS_SUB *)0) {          /* Find a free slot (there is one, see NbrSubs)           */
+        ix++;
+    }
+    p_bus->SubTbl[ix] = p_sub;
+    p_bus->NbrSubs++;
+    topics_rem = topics;
+    while (topics_rem != (OS_FLAGS)0) {                     /* Add the subscriber to the bitmap of each topic         */
+        topic       = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)topics_rem);
+        topics_rem &= (OS_FLAGS)~(OS_FLAGS)DEF_BIT(topic);
+        p_bus->TopicSubTbl[topic] |= (CPU_DATA)DEF_BIT(ix);
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
@@ -98,6 +98,15 @@ void  OSInit (OS_ERR  *p_err)
     OSSchedRoundRobinDfltTimeQuanta = OSCfg_TickRate_Hz / 10u;
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    OSSchedEDFUtil                  = (OS_CPU_USAGE)0u;
+    OSSchedEDFMissCtr               = (OS_CTR      )0u;
+#endif
+
+#if OS_CFG_SCHED_TBL_EN > 0u
+    OSSchedTblListPtr               = (OS_SCHED_TBL *)0;
+#endif
+
     if (OSCfg_ISRStkSize > (CPU_STK_SIZE)0) {
         p_stk = OSCfg_ISRStkBasePtr;                        /* Clear exception stack for stack checking.              */
         if (p_stk != (CPU_STK *)0) {
@@ -663,6 +672,14 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
     }
 
     CPU_CRITICAL_ENTER();
+#if OS_CFG_SCHED_EDF_EN > 0u
+    if (OSPrioCur == (OS_PRIO)OS_CFG_SCHED_EDF_PRIO) {      /* The EDF level is not time sliced                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[OSPrioCur];                     /* Can't yield if it's the only task at that priority     */
     if (p_rdy_list->NbrEntries < (OS_OBJ_QTY)2) {
         CPU_CRITICAL_EXIT();
@@ -842,7 +859,7 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
                  (OS_MSG_QTY  )0u,
                  (OS_TICK     )0u,
                  (void       *)0,
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS),
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_NO_TLS),
                  (OS_ERR     *)p_err);
 }
 
@@ -2167,6 +2184,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    if (p_tcb->Prio == (OS_PRIO)OS_CFG_SCHED_EDF_PRIO) {    /* The EDF level is kept in deadline order                */
+        OS_EDFRdyListInsert(p_tcb, DEF_TRUE);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->NbrEntries == (OS_OBJ_QTY)0) {          /* CASE 0: Insert when there are no entries               */
         p_rdy_list->NbrEntries =  (OS_OBJ_QTY)1;            /*         This is the first entry                        */
@@ -2248,6 +2272,13 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    if (p_tcb->Prio == (OS_PRIO)OS_CFG_SCHED_EDF_PRIO) {    /* The EDF level is kept in deadline order                */
+        OS_EDFRdyListInsert(p_tcb, DEF_FALSE);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->NbrEntries == (OS_OBJ_QTY)0) {          /* CASE 0: Insert when there are no entries               */
         p_rdy_list->NbrEntries  = (OS_OBJ_QTY)1;            /*         This is the first entry                        */
@@ -2559,6 +2590,12 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         return;
     }
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    if (p_rdy_list == &OSRdyList[OS_CFG_SCHED_EDF_PRIO]) {  /* The EDF level is not time sliced                       */
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_tcb = p_rdy_list->HeadPtr;                            /* Decrement time quanta counter                          */
 
@@ -2608,7 +2645,8 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 *                                                     BLOCK A TASK
 *
 * Description: This function is called to remove a task from the ready list and also insert it in the timer tick list if
-*              the specified timeout is non-zero.
+*              the specified timeout is non-zero.  A timeout set with OSTimeTimeoutSetCycles() takes precedence over
+*              'timeout' and puts the task in the high-resolution tick list instead.
 *
 * Arguments  : p_tcb          is a pointer to the OS_TCB of the task block
 *              -----
@@ -2624,6 +2662,15 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 void  OS_TaskBlock (OS_TCB   *p_tcb,
                     OS_TICK   timeout)
 {
+#if OS_CFG_TIME_HR_EN > 0u
+    if (p_tcb->TickHrTimeout > (CPU_TS_TMR)0) {             /* High-resolution timeout set for this pend?              */
+        OS_TickListInsertHr(p_tcb, p_tcb->TickHrTimeout);
+        p_tcb->TickHrTimeout = (CPU_TS_TMR)0;               /* ... it only applies once                                */
+        p_tcb->TaskState     = OS_TASK_STATE_PEND_TIMEOUT;
+        OS_RdyListRemove(p_tcb);
+        return;
+    }
+#endif
     if (timeout > (OS_TICK)0) {                             /* Add task to tick list if timeout non zero               */
         OS_TickListInsert(&OSTickListTimeout, p_tcb, timeout);
         p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
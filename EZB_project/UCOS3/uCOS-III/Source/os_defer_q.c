@@ -0,0 +1,328 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                DEFERRED WORK QUEUES
+*
+* File    : OS_DEFER_Q.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A deferred work queue lets an ISR hand the bulk of its processing (the 'bottom half') to a task: the
+*               ISR posts a function and its argument, and the worker task of the queue calls the function soon after,
+*               at the priority given to OSDeferQCreate().  Several queues may be created to get several priorities.
+*
+*           (2) The items are kept in a ring of 2^n entries.  A post reserves the next entry with an exclusive
+*               load/store sequence (see OS_CPU_LDREX()), or in a short critical section if the port has none, so
+*               ISRs of any priority and tasks may post concurrently.  The entry is published by storing its function
+*               pointer last.
+*
+*           (3) The worker task runs every published item in order each time it wakes up.  A post only wakes it up if
+*               the worker reached the new entry, i.e. if the worker has nothing else to run.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_defer_q__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_DEFER_Q_EN > 0u
+/*
+************************************************************************************************************************
+*                                             CREATE A DEFERRED WORK QUEUE
+*
+* Description: This function creates a deferred work queue and its worker task.
+*
+* Arguments  : p_dq          is a pointer to the deferred work queue to create.
+*
+*              p_name        is a pointer to an ASCII string used to name the queue and its worker task.
+*
+*              p_item_tbl    is a pointer to the storage of the items.
+*
+*              nbr_items     is the number of entries in 'p_item_tbl'.  It must be a power of 2 (at least 2).
+*
+*              p_tcb         is a pointer to the TCB of the worker task.
+*
+*              prio          is the priority of the worker task.
+*
+*              p_stk_base    is a pointer to the base address of the stack of the worker task.
+*
+*              stk_size      is the size of the stack of the worker task (in number of CPU_STK elements).
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_CREATE_ISR                 if you called this function from an ISR
+*                                OS_ERR_DEFER_Q_SIZE               if 'nbr_items' is not a power of 2 of at least 2
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to create the queue after you
+*                                                                  called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_dq' or 'p_item_tbl' is a NULL pointer
+*                                OS_ERR_xxx                        an error code returned by OSTaskCreate()
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSDeferQCreate (OS_DEFER_Q       *p_dq,
+                      CPU_CHAR         *p_name,
+                      OS_DEFER_ITEM    *p_item_tbl,
+                      OS_OBJ_QTY        nbr_items,
+                      OS_TCB           *p_tcb,
+                      OS_PRIO           prio,
+                      CPU_STK          *p_stk_base,
+                      CPU_STK_SIZE      stk_size,
+                      OS_ERR           *p_err)
+{
+    OS_OBJ_QTY  i;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_dq       == (OS_DEFER_Q    *)0) ||               /* Validate arguments                                     */
+        (p_item_tbl == (OS_DEFER_ITEM *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((nbr_items < 2u) ||                                 /* The ring is indexed with a mask                        */
+        ((nbr_items & (nbr_items - 1u)) != 0u)) {
+       *p_err = OS_ERR_DEFER_Q_SIZE;
+        return;
+    }
+#endif
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_dq->Type        = OS_OBJ_TYPE_DEFER_Q;                /* Mark the data structure as a deferred work queue       */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_dq->NamePtr     = p_name;
+#endif
+    for (i = 0u; i < nbr_items; i++) {
+        p_item_tbl[i].FnctPtr = (OS_DEFER_FNCT)0;           /* No entry published yet                                 */
+        p_item_tbl[i].FnctArg = (void        *)0;
+    }
+    p_dq->ItemTbl     = p_item_tbl;
+    p_dq->ItemTblMask = (CPU_INT32U)nbr_items - 1u;
+    p_dq->InIx        = (CPU_INT32U)0;
+    p_dq->OutIx       = (CPU_INT32U)0;
+    p_dq->TCBPtr      = p_tcb;
+    p_dq->RunCtr      = (OS_CTR)0;
+    p_dq->OvfCtr      = (OS_CTR)0;
+
+    OSTaskCreate(p_tcb,                                     /* Create the worker task                                 */
+                 p_name,
+                 OS_DeferQTask,
+                 (void       *)p_dq,
+                 prio,
+                 p_stk_base,
+                 stk_size / 10u,
+                 stk_size,
+                 (OS_MSG_QTY  )0,
+                 (OS_TICK     )0,
+                 (void       *)0,
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK),
+                 p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         POST AN ITEM TO A DEFERRED WORK QUEUE
+*
+* Description: This function queues a call of 'p_fnct' with 'p_arg' to be made by the worker task of the queue.  It
+*              is meant to be called by ISRs, but tasks may call it too.
+*
+* Arguments  : p_dq          is a pointer to the deferred work queue.
+*
+*              p_fnct        is a pointer to the function to call.
+*
+*              p_arg         is the argument passed to 'p_fnct'.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              if the call was successful
+*                                OS_ERR_DEFER_Q_FULL      if every entry of the queue is in use (see .OvfCtr)
+*                                OS_ERR_OBJ_PTR_NULL      if 'p_dq' or 'p_fnct' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          if 'p_dq' is not a deferred work queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) The cost does not depend on the number of items queued; see Note #2 and #3 at the top of this file.
+************************************************************************************************************************
+*/
+
+void  OSDeferQPost (OS_DEFER_Q     *p_dq,
+                    OS_DEFER_FNCT   p_fnct,
+                    void           *p_arg,
+                    OS_ERR         *p_err)
+{
+    OS_DEFER_ITEM  *p_item;
+    CPU_INT32U      in_ix;
+#ifdef OS_CPU_LDREX
+    CPU_INT32U      res;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_dq   == (OS_DEFER_Q  *)0) ||                     /* Validate arguments                                     */
+        (p_fnct == (OS_DEFER_FNCT)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_dq->Type != OS_OBJ_TYPE_DEFER_Q) {                /* Make sure the queue was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#ifdef OS_CPU_LDREX
+    do {                                                    /* Reserve the next entry                                 */
+        OS_CPU_LDREX(&p_dq->InIx, in_ix);
+        if ((in_ix - p_dq->OutIx) > p_dq->ItemTblMask) {    /* All entries in use                                     */
+            OS_CPU_CLREX();
+            p_dq->OvfCtr++;
+           *p_err = OS_ERR_DEFER_Q_FULL;
+            return;
+        }
+        OS_CPU_STREX(&p_dq->InIx, in_ix + 1u, res);
+    } while (res != (CPU_INT32U)0);                         /* Interrupted, try again                                 */
+#else
+    CPU_CRITICAL_ENTER();
+    in_ix = p_dq->InIx;
+    if ((in_ix - p_dq->OutIx) > p_dq->ItemTblMask) {
+        p_dq->OvfCtr++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_DEFER_Q_FULL;
+        return;
+    }
+    p_dq->InIx = in_ix + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    p_item          = &p_dq->ItemTbl[in_ix & p_dq->ItemTblMask];
+    p_item->FnctArg = p_arg;
+    CPU_WMB();                                              /* Argument visible before the entry is published         */
+    p_item->FnctPtr = p_fnct;
+    CPU_MB();
+
+    if (p_dq->OutIx == in_ix) {                             /* Worker has nothing else to run: wake it up             */
+        (void)OSTaskSemPost(p_dq->TCBPtr,
+                            OS_OPT_POST_NONE,
+                            p_err);
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         WORKER TASK OF A DEFERRED WORK QUEUE
+*
+* Description: This task runs the items posted to a deferred work queue.
+*
+* Arguments  : p_arg     is a pointer to the deferred work queue (see OSDeferQCreate()).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_DeferQTask (void  *p_arg)
+{
+    OS_DEFER_Q     *p_dq;
+    OS_DEFER_ITEM  *p_item;
+    OS_DEFER_FNCT   p_fnct;
+    void           *p_fnct_arg;
+    CPU_INT32U      out_ix;
+    OS_ERR          err;
+    CPU_TS          ts;
+
+
+
+    p_dq = (OS_DEFER_Q *)p_arg;
+    while (DEF_ON) {
+        (void)OSTaskSemPend((OS_TICK )0,                    /* Wait for an item                                       */
+                            (OS_OPT  )OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)&ts,
+                            (OS_ERR *)&err);
+
+        out_ix = p_dq->OutIx;
+        p_item = &p_dq->ItemTbl[out_ix & p_dq->ItemTblMask];
+        p_fnct = p_item->FnctPtr;
+        while (p_fnct != (OS_DEFER_FNCT)0) {                /* Run the batch of published items                       */
+            CPU_RMB();
+            p_fnct_arg      = p_item->FnctArg;
+            p_item->FnctPtr = (OS_DEFER_FNCT)0;             /* Free the entry ...                                     */
+            CPU_MB();
+            out_ix++;
+            p_dq->OutIx     = out_ix;                       /* ... before it can be reserved again                    */
+            p_dq->RunCtr++;
+
+            (*p_fnct)(p_fnct_arg);
+
+            p_item = &p_dq->ItemTbl[out_ix & p_dq->ItemTblMask];
+            p_fnct = p_item->FnctPtr;
+        }
+    }
+}
+#endif
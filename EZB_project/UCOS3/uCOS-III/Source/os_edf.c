@@ -0,0 +1,406 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                        EARLIEST DEADLINE FIRST SCHEDULING CLASS
+*
+* File    : OS_EDF.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) One priority level, OS_CFG_SCHED_EDF_PRIO, is scheduled Earliest Deadline First.  Priorities above and
+*               below it keep their fixed priority behavior: an EDF task only runs when no higher priority task is
+*               ready, and then the ready EDF task with the earliest absolute deadline runs first.
+*
+*           (2) A task joins the EDF class with OSTaskEDFSet(), giving its period, its relative deadline & its worst
+*               case execution time (the budget), all in ticks.  It then runs one job per period and calls
+*               OSTaskEDFPeriodWait() at the end of each job.
+*
+*           (3) Admission control uses the density test: the sum of budget / min(period, deadline) over all EDF
+*               tasks may not exceed OS_CFG_SCHED_EDF_UTIL_MAX (in units of 0.01%).  The bound MUST leave room for
+*               the CPU time taken by higher priority tasks and ISRs.
+*
+*           (4) The ready list of the EDF level is kept sorted by absolute deadline, so insertion is linear in the
+*               number of ready tasks at that level.  Tasks at that level which are not in the EDF class are kept
+*               behind all EDF tasks.  Round-robin does not apply to the EDF level.
+*
+*           (5) A job that completes after its deadline, or that the statistic task finds still running past its
+*               deadline (with OS_CFG_DBG_EN), is counted once in the task's .EDFMissCtr & in OSSchedEDFMissCtr.
+*               OSStatReset() clears both.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_edf__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_SCHED_EDF_EN > 0u
+/*
+************************************************************************************************************************
+*                                        SET THE EDF PARAMETERS OF A TASK
+*
+* Description: This function places a task in the EDF class, changes its parameters or removes it from the class.
+*
+* Arguments  : p_tcb        is a pointer to the TCB of the task.  A NULL pointer specifies the calling task.
+*
+*              period       is the period of the task, in ticks.  0 removes the task from the EDF class.
+*
+*              deadline     is the deadline of each job relative to its release, in ticks.
+*
+*              budget       is the worst case execution time of one job, in ticks.
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                the call was successful
+*                               OS_ERR_EDF_ADMISSION       admitting the task would exceed OS_CFG_SCHED_EDF_UTIL_MAX
+*                               OS_ERR_EDF_ISR             if you called this function from an ISR
+*                               OS_ERR_EDF_PRIO            the task does not run at OS_CFG_SCHED_EDF_PRIO
+*                               OS_ERR_EDF_TIME_INVALID    'deadline' or 'budget' is 0 or 'budget' is larger than
+*                                                          'period' or 'deadline'
+*                               OS_ERR_STATE_INVALID       the task is not created or was deleted
+*
+* Returns    : none
+*
+* Note(s)    : 1) The first job of the task is released when this function is called.
+************************************************************************************************************************
+*/
+
+void  OSTaskEDFSet (OS_TCB   *p_tcb,
+                    OS_TICK   period,
+                    OS_TICK   deadline,
+                    OS_TICK   budget,
+                    OS_ERR   *p_err)
+{
+    OS_TICK       window;
+    OS_CPU_USAGE  util;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_EDF_ISR;
+        return;
+    }
+#endif
+
+    util = (OS_CPU_USAGE)0u;
+    if (period > (OS_TICK)0) {
+        if ((deadline == (OS_TICK)0) ||
+            (budget   == (OS_TICK)0)) {
+           *p_err = OS_ERR_EDF_TIME_INVALID;
+            return;
+        }
+        if (deadline < period) {                            /* Jobs must fit in the shorter of both windows           */
+            window = deadline;
+        } else {
+            window = period;
+        }
+        if (budget > window) {                              /* A job could never meet its deadline                    */
+           *p_err = OS_ERR_EDF_TIME_INVALID;
+            return;
+        }
+                                                            /* Utilization in 0.01% units, rounded up                 */
+        util = (OS_CPU_USAGE)(((CPU_INT64U)budget * 10000u + window - 1u) / window);
+    }
+
+    OS_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                             /* Set the calling task's parameters?                     */
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if ((p_tcb->TaskState == OS_TASK_STATE_DEL) ||          /* Task must exist                                        */
+        (p_tcb->StkPtr    == (CPU_STK *)0)) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_STATE_INVALID;
+        return;
+    }
+
+    if ((period      >  (OS_TICK)0) &&
+        (p_tcb->Prio != (OS_PRIO)OS_CFG_SCHED_EDF_PRIO)) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_PRIO;
+        return;
+    }
+                                                            /* Admission control (see Note #3 at top of file)         */
+    if (((CPU_INT32U)OSSchedEDFUtil - p_tcb->EDFUtil + util) > OS_CFG_SCHED_EDF_UTIL_MAX) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_ADMISSION;
+        return;
+    }
+
+    OSSchedEDFUtil         = OSSchedEDFUtil - p_tcb->EDFUtil + util;
+    p_tcb->EDFUtil         = util;
+    p_tcb->EDFPeriod       = period;
+    p_tcb->EDFDeadlineRel  = deadline;
+    p_tcb->EDFRelease      = OSTickCtr;                     /* Release the first job (see Note #1)                    */
+    p_tcb->EDFDeadline     = OSTickCtr + deadline;
+    p_tcb->EDFJobLate      = DEF_FALSE;
+
+    if (p_tcb->TaskState == OS_TASK_STATE_RDY) {            /* Move the task to its place in the ready list           */
+        OS_RdyListRemove(p_tcb);
+        OS_RdyListInsert(p_tcb);
+    }
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();                                              /* The new deadline may preempt the calling task          */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          END THE CURRENT JOB OF AN EDF TASK
+*
+* Description: This function is called by an EDF task when its current job is done.  The task sleeps until the release
+*              of its next job, one period after the release of the current one.  The deadline of the next job is set
+*              at the same time.
+*
+* Arguments  : p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                the call was successful
+*                               OS_ERR_EDF_ISR             if you called this function from an ISR
+*                               OS_ERR_EDF_NOT_SET         the calling task is not in the EDF class
+*                               OS_ERR_SCHED_LOCKED        can't wait when the scheduler is locked
+*
+* Returns    : none
+*
+* Note(s)    : 1) If the next job is already released (the current job overran its period), the task is not delayed.
+*                 It is re-sorted in the ready list with the deadline of the next job and keeps running if that
+*                 deadline is still the earliest.
+************************************************************************************************************************
+*/
+
+void  OSTaskEDFPeriodWait (OS_ERR  *p_err)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_EDF_ISR;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {        /* Can't wait when the scheduler is locked                */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OS_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->EDFPeriod == (OS_TICK)0) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_NOT_SET;
+        return;
+    }
+
+    OS_EDFMissChk(p_tcb);                                   /* Count the job if it completed past its deadline        */
+
+    OS_RdyListRemove(p_tcb);
+    p_tcb->EDFRelease  += p_tcb->EDFPeriod;                 /* Next job                                               */
+    p_tcb->EDFDeadline  = p_tcb->EDFRelease + p_tcb->EDFDeadlineRel;
+    p_tcb->EDFJobLate   = DEF_FALSE;
+
+    OS_TickListInsertDly(p_tcb,                             /* Sleep until the next release ...                       */
+                         p_tcb->EDFRelease,
+                         OS_OPT_TIME_MATCH,
+                        &err);
+    if (err != OS_ERR_NONE) {                               /* ... unless it already occurred (see Note #1)           */
+        OS_RdyListInsert(p_tcb);
+    }
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        INSERT A TASK IN THE EDF READY LIST
+*
+* Description: This function inserts a TCB in the ready list of OS_CFG_SCHED_EDF_PRIO, in the order of its absolute
+*              deadline.
+*
+* Arguments  : p_tcb        is a pointer to the TCB to insert.
+*              -----
+*
+*              head         DEF_TRUE  places the TCB before the TCBs having the same deadline (like
+*                                     OS_RdyListInsertHead())
+*                           DEF_FALSE places it after them (like OS_RdyListInsertTail())
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Deadlines are compared modulo the tick counter: 'a' is earlier than 'b' when (b - a) is in the lower
+*                 half of the OS_TICK range.
+*
+*              3) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_EDFRdyListInsert (OS_TCB       *p_tcb,
+                           CPU_BOOLEAN   head)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb_next;
+    OS_TCB       *p_tcb_prev;
+    OS_TICK       diff;
+    CPU_BOOLEAN   before;
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    p_tcb_next = p_rdy_list->HeadPtr;
+    while (p_tcb_next != (OS_TCB *)0) {                     /* Find the first TCB that runs after 'p_tcb'             */
+        if (p_tcb->EDFPeriod == (OS_TICK)0) {               /* Tasks outside the EDF class go last                    */
+            if (p_tcb_next->EDFPeriod == (OS_TICK)0) {
+                before = head;
+            } else {
+                before = DEF_FALSE;
+            }
+        } else if (p_tcb_next->EDFPeriod == (OS_TICK)0) {
+            before = DEF_TRUE;
+        } else {
+            diff = p_tcb_next->EDFDeadline - p_tcb->EDFDeadline;
+            if (diff == (OS_TICK)0) {
+                before = head;
+            } else if (diff < OS_TICK_TH_INIT) {            /* Earlier deadline (see Note #2)                         */
+                before = DEF_TRUE;
+            } else {
+                before = DEF_FALSE;
+            }
+        }
+        if (before == DEF_TRUE) {
+            break;
+        }
+        p_tcb_next = p_tcb_next->NextPtr;
+    }
+
+    if (p_tcb_next == (OS_TCB *)0) {                        /* Link 'p_tcb' before 'p_tcb_next' ...                   */
+        p_tcb_prev          = p_rdy_list->TailPtr;          /* ... which is the end of the list                       */
+        p_rdy_list->TailPtr = p_tcb;
+    } else {
+        p_tcb_prev          = p_tcb_next->PrevPtr;
+        p_tcb_next->PrevPtr = p_tcb;
+    }
+    p_tcb->NextPtr = p_tcb_next;
+    p_tcb->PrevPtr = p_tcb_prev;
+    if (p_tcb_prev == (OS_TCB *)0) {
+        p_rdy_list->HeadPtr = p_tcb;
+    } else {
+        p_tcb_prev->NextPtr = p_tcb;
+    }
+    p_rdy_list->NbrEntries++;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              CHECK FOR A MISSED DEADLINE
+*
+* Description: This function counts a deadline miss if the current job of an EDF task is past its deadline and was not
+*              counted yet.  It is called when a job completes and periodically by the statistic task.
+*
+* Arguments  : p_tcb        is a pointer to the TCB of the task.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) A task waiting for its next release already holds the deadline of that job, which cannot be reached
+*                 before the release.  No check of the task state is needed.
+************************************************************************************************************************
+*/
+
+void  OS_EDFMissChk (OS_TCB  *p_tcb)
+{
+    OS_TICK  late;
+
+
+    if ((p_tcb->EDFPeriod  == (OS_TICK)0) ||                /* Not an EDF task or miss already counted                */
+        (p_tcb->EDFJobLate == DEF_TRUE)) {
+        return;
+    }
+
+    late = OSTickCtr - p_tcb->EDFDeadline;
+    if ((late > (OS_TICK)0) &&
+        (late < OS_TICK_TH_INIT)) {                         /* Past the deadline?                                     */
+        p_tcb->EDFJobLate = DEF_TRUE;
+        p_tcb->EDFMissCtr++;
+        OSSchedEDFMissCtr++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         REMOVE A TASK FROM THE EDF CLASS
+*
+* Description: This function gives back the utilization of a task when it is deleted.
+*
+* Arguments  : p_tcb        is a pointer to the TCB of the task.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled or the scheduler locked.
+************************************************************************************************************************
+*/
+
+void  OS_EDFRemove (OS_TCB  *p_tcb)
+{
+    OSSchedEDFUtil   -= p_tcb->EDFUtil;
+    p_tcb->EDFUtil    = (OS_CPU_USAGE)0u;
+    p_tcb->EDFPeriod  = (OS_TICK     )0u;
+}
+#endif
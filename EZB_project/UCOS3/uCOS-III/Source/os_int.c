@@ -388,7 +388,7 @@ void  OS_IntQTaskInit (OS_ERR  *p_err)
                  (OS_MSG_QTY  )0u,
                  (OS_TICK     )0u,
                  (void       *)0,
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK),
                  (OS_ERR     *)p_err);
 }
 
@@ -323,6 +323,271 @@ void  OSMemPut (OS_MEM  *p_mem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                        CREATE A PER-TASK MAGAZINE FOR A PARTITION
+*
+* Description : Bind a magazine, i.e. a small cache of free blocks, to a memory partition and to the calling task.
+*               OSMemMagGet() and OSMemMagPut() called by that task are then served from the magazine without a
+*               critical section.  Only when the magazine runs empty or full are OS_MEM_MAG_BATCH blocks exchanged
+*               with the partition, in a single critical section.
+*
+* Arguments   : p_mag    is a pointer to a magazine which is allocated in user memory space.
+*
+*               p_mem    is a pointer to the memory partition the magazine caches blocks of.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE                    if the magazine has been created correctly.
+*                            OS_ERR_MEM_CREATE_ISR          if you called this function from an ISR.
+*                            OS_ERR_MEM_INVALID_P_DATA      if you passed a NULL pointer for 'p_mag'
+*                            OS_ERR_MEM_INVALID_P_MEM       if you passed a NULL pointer for 'p_mem'
+*
+* Returns     : none
+*
+* Note(s)     : (1) Blocks held in a magazine are counted as used by the partition: other users of the partition can
+*                   see OS_ERR_MEM_NO_FREE_BLKS while up to OS_CFG_MEM_MAG_SIZE blocks are parked in a magazine.
+*                   Call OSMemMagFlush() to give them back, e.g. before the owning task is deleted.
+*
+*               (2) A magazine is private to the task that created it and MUST NOT be used from an ISR.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_MEM_MAG_EN > 0u
+void  OSMemMagCreate (OS_MEM_MAG  *p_mag,
+                      OS_MEM      *p_mem,
+                      OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mag == (OS_MEM_MAG *)0) {                         /* Must point to a valid magazine                         */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (p_mem == (OS_MEM *)0) {                             /* Must point to a valid memory partition                 */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+    p_mag->MemPtr   =  p_mem;
+    p_mag->TCBPtr   =  OSTCBCurPtr;                         /* Magazine belongs to the calling task                   */
+    p_mag->NbrBlks  = (OS_MEM_QTY)0;
+    p_mag->FillCtr  = (OS_CTR)0;
+    p_mag->DrainCtr = (OS_CTR)0;
+   *p_err           =  OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            GET A MEMORY BLOCK FROM A MAGAZINE
+*
+* Description : Get a memory block from the calling task's magazine, refilling the magazine from its partition when it
+*               is empty.
+*
+* Arguments   : p_mag   is a pointer to the magazine
+*
+*               p_err   is a pointer to a variable containing an error message which will be set by this function to
+*                       either:
+*
+*                       OS_ERR_NONE               if a block was obtained.
+*                       OS_ERR_MEM_INVALID_P_DATA if you passed a NULL pointer for 'p_mag'
+*                       OS_ERR_MEM_MAG_ISR        if you called this function from an ISR
+*                       OS_ERR_MEM_MAG_NOT_OWNER  if the calling task did not create the magazine
+*                       OS_ERR_MEM_NO_FREE_BLKS   if both the magazine and the partition are empty
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+************************************************************************************************************************
+*/
+
+void  *OSMemMagGet (OS_MEM_MAG  *p_mag,
+                    OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Magazines are private to tasks                         */
+       *p_err = OS_ERR_MEM_MAG_ISR;
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mag == (OS_MEM_MAG *)0) {                         /* Must point to a valid magazine                         */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return ((void *)0);
+    }
+    if (p_mag->TCBPtr != OSTCBCurPtr) {                     /* Only the owner may use the magazine                    */
+       *p_err = OS_ERR_MEM_MAG_NOT_OWNER;
+        return ((void *)0);
+    }
+#endif
+
+    if (p_mag->NbrBlks == (OS_MEM_QTY)0) {                  /* Magazine empty: take a batch from the partition        */
+        OS_MemMagFill(p_mag);
+        if (p_mag->NbrBlks == (OS_MEM_QTY)0) {
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+            return ((void *)0);
+        }
+    }
+    p_mag->NbrBlks--;
+   *p_err = OS_ERR_NONE;
+    return (p_mag->BlkTbl[p_mag->NbrBlks]);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE A MEMORY BLOCK TO A MAGAZINE
+*
+* Description : Returns a memory block to the calling task's magazine, draining part of the magazine to its partition
+*               when it is full.
+*
+* Arguments   : p_mag    is a pointer to the magazine
+*
+*               p_blk    is a pointer to the memory block being released.  It must belong to the magazine's partition.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the memory block was released
+*                            OS_ERR_MEM_FULL           if the magazine is full and its partition has no room for a
+*                                                      batch, e.g. after a block was released twice
+*                            OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for the block to release
+*                            OS_ERR_MEM_INVALID_P_DATA if you passed a NULL pointer for 'p_mag'
+*                            OS_ERR_MEM_MAG_ISR        if you called this function from an ISR
+*                            OS_ERR_MEM_MAG_NOT_OWNER  if the calling task did not create the magazine
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+void  OSMemMagPut (OS_MEM_MAG  *p_mag,
+                   void        *p_blk,
+                   OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Magazines are private to tasks                         */
+       *p_err = OS_ERR_MEM_MAG_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mag == (OS_MEM_MAG *)0) {                         /* Must point to a valid magazine                         */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (p_blk == (void *)0) {                               /* Must release a valid block                             */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    if (p_mag->TCBPtr != OSTCBCurPtr) {                     /* Only the owner may use the magazine                    */
+       *p_err = OS_ERR_MEM_MAG_NOT_OWNER;
+        return;
+    }
+#endif
+
+    if (p_mag->NbrBlks >= (OS_MEM_QTY)OS_CFG_MEM_MAG_SIZE) {/* Magazine full: give a batch back to the partition     */
+        OS_MemMagDrain(p_mag, (OS_MEM_QTY)OS_MEM_MAG_BATCH);
+        if (p_mag->NbrBlks >= (OS_MEM_QTY)OS_CFG_MEM_MAG_SIZE) {
+           *p_err = OS_ERR_MEM_FULL;                        /* Partition already full: the block is not ours          */
+            return;
+        }
+    }
+    p_mag->BlkTbl[p_mag->NbrBlks] = p_blk;
+    p_mag->NbrBlks++;
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        RETURN ALL CACHED BLOCKS TO THE PARTITION
+*
+* Description : Empties the calling task's magazine into its partition.
+*
+* Arguments   : p_mag    is a pointer to the magazine
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the magazine was flushed
+*                            OS_ERR_MEM_FULL           if the partition had no room for every cached block
+*                            OS_ERR_MEM_INVALID_P_DATA if you passed a NULL pointer for 'p_mag'
+*                            OS_ERR_MEM_MAG_ISR        if you called this function from an ISR
+*                            OS_ERR_MEM_MAG_NOT_OWNER  if the calling task did not create the magazine
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+void  OSMemMagFlush (OS_MEM_MAG  *p_mag,
+                     OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Magazines are private to tasks                         */
+       *p_err = OS_ERR_MEM_MAG_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mag == (OS_MEM_MAG *)0) {                         /* Must point to a valid magazine                         */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (p_mag->TCBPtr != OSTCBCurPtr) {                     /* Only the owner may use the magazine                    */
+       *p_err = OS_ERR_MEM_MAG_NOT_OWNER;
+        return;
+    }
+#endif
+
+    if (p_mag->NbrBlks > (OS_MEM_QTY)0) {
+        OS_MemMagDrain(p_mag, p_mag->NbrBlks);
+        if (p_mag->NbrBlks > (OS_MEM_QTY)0) {
+           *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           ADD MEMORY PARTITION TO DEBUG LIST
@@ -352,6 +617,96 @@ void  OS_MemDbgListAdd (OS_MEM  *p_mem)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                       MOVE A BATCH OF BLOCKS FROM A MAGAZINE TO ITS PARTITION
+*
+* Description : This function is called by OSMemMagPut() and OSMemMagFlush() to return up to 'nbr_blks' cached blocks
+*               to the partition in a single critical section.
+*
+* Arguments   : p_mag      is a pointer to the magazine
+*
+*               nbr_blks   is the number of blocks to return (at most the number of blocks in the magazine)
+*
+* Returns     : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Fewer blocks are returned when the partition fills up; 'DrainCtr' only counts drains that returned at
+*                 least one block.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_MEM_MAG_EN > 0u
+void  OS_MemMagDrain (OS_MEM_MAG  *p_mag,
+                      OS_MEM_QTY   nbr_blks)
+{
+    OS_MEM      *p_mem;
+    void        *p_blk;
+    OS_MEM_QTY   nbr_blks_mag;
+    CPU_SR_ALLOC();
+
+
+    p_mem        = p_mag->MemPtr;
+    nbr_blks_mag = p_mag->NbrBlks;
+    CPU_CRITICAL_ENTER();
+    while ((nbr_blks         > (OS_MEM_QTY)0) &&
+           (p_mem->NbrFree   < p_mem->NbrMax)) {            /* Never overfill the partition                           */
+        p_mag->NbrBlks--;
+        p_blk               = p_mag->BlkTbl[p_mag->NbrBlks];
+       *(void **)p_blk      = p_mem->FreeListPtr;           /* Insert released block into free block list             */
+        p_mem->FreeListPtr  = p_blk;
+        p_mem->NbrFree++;
+        nbr_blks--;
+    }
+    CPU_CRITICAL_EXIT();
+    if (p_mag->NbrBlks != nbr_blks_mag) {                   /* See Note #2                                            */
+        p_mag->DrainCtr++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       MOVE A BATCH OF BLOCKS FROM A PARTITION TO A MAGAZINE
+*
+* Description : This function is called by OSMemMagGet() to take up to OS_MEM_MAG_BATCH free blocks from the partition
+*               in a single critical section.
+*
+* Arguments   : p_mag      is a pointer to the (empty) magazine
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MemMagFill (OS_MEM_MAG  *p_mag)
+{
+    OS_MEM      *p_mem;
+    void        *p_blk;
+    OS_MEM_QTY   nbr_blks;
+    CPU_SR_ALLOC();
+
+
+    p_mem    = p_mag->MemPtr;
+    nbr_blks = (OS_MEM_QTY)OS_MEM_MAG_BATCH;
+    CPU_CRITICAL_ENTER();
+    while ((nbr_blks       > (OS_MEM_QTY)0) &&
+           (p_mem->NbrFree > (OS_MEM_QTY)0)) {
+        p_blk                         = p_mem->FreeListPtr; /* Point to next free memory block                        */
+        p_mem->FreeListPtr            = *(void **)p_blk;    /* Adjust pointer to new free list                        */
+        p_mem->NbrFree--;
+        p_mag->BlkTbl[p_mag->NbrBlks] = p_blk;
+        p_mag->NbrBlks++;
+        nbr_blks--;
+    }
+    CPU_CRITICAL_EXIT();
+    p_mag->FillCtr++;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           INITIALIZE MEMORY PARTITION MANAGER
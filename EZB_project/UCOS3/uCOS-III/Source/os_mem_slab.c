@@ -0,0 +1,417 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                          SIZE-CLASS MEMORY BLOCK MANAGEMENT
+*
+* File    : OS_MEM_SLAB.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A slab is a set of OS_MEM partitions, one per power-of-two size class from OS_MEM_SLAB_BLK_SIZE_MIN
+*               to OS_MEM_SLAB_BLK_SIZE_MAX bytes.  All classes are carved, in ascending order, out of a single
+*               contiguous storage area so that OSMemSlabPut() can find the owning class from the block address alone.
+*
+*           (2) OSMemSlabGet() and OSMemSlabPut() only use CPU critical sections and can be called from ISRs.  Their
+*               execution time is bounded by OS_MEM_SLAB_NBR_CLASS.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_mem_slab__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_MEM_EN > 0u) && (OS_CFG_MEM_SLAB_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               CREATE A SIZE-CLASS SLAB
+*
+* Description : Create a set of fixed-size memory partitions, one per power-of-two size class, out of a single
+*               contiguous storage area.
+*
+* Arguments   : p_slab          is a pointer to a slab control block which is allocated in user memory space.
+*
+*               p_name          is a pointer to an ASCII string to provide a name to the slab.
+*
+*               p_addr          is the starting address of the storage area.  The storage area must be at least
+*                               OS_MEM_SLAB_SIZE() bytes for the block counts found in 'p_nbr_blks_tbl'.
+*
+*               p_nbr_blks_tbl  is a table of OS_MEM_SLAB_NBR_CLASS entries giving the number of blocks to create in
+*                               each class, smallest class first.  An entry of 0 leaves that class empty; requests
+*                               for it are then served from the next larger class.
+*
+*               p_err           is a pointer to a variable containing an error message which will be set by this
+*                               function to either:
+*
+*                                   OS_ERR_NONE                    if the slab has been created correctly.
+*                                   OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the slab after you
+*                                                                    called OSSafetyCriticalStart().
+*                                   OS_ERR_MEM_CREATE_ISR          if you called this function from an ISR.
+*                                   OS_ERR_MEM_INVALID_P_MEM       if you passed a NULL pointer for 'p_slab'
+*                                   OS_ERR_MEM_INVALID_P_ADDR      if 'p_addr' is NULL or not pointer aligned
+*                                   OS_ERR_MEM_INVALID_P_DATA      if you passed a NULL pointer for 'p_nbr_blks_tbl'
+*                                   OS_ERR_MEM_INVALID_BLKS        if a class was given a single block (must be 0 or
+*                                                                    >= 2) or all classes are empty
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+void  OSMemSlabCreate (OS_MEM_SLAB       *p_slab,
+                       CPU_CHAR          *p_name,
+                       void              *p_addr,
+                       OS_MEM_QTY  const *p_nbr_blks_tbl,
+                       OS_ERR            *p_err)
+{
+#if OS_CFG_ARG_CHK_EN > 0u
+    CPU_DATA       align_msk;
+    OS_MEM_QTY     nbr_blks_tot;
+#endif
+    CPU_INT08U    *p_blk;
+    OS_MEM_SIZE    blk_size;
+    OS_MEM_QTY     n_blks;
+    OS_MEM_QTY     i;
+    CPU_INT08U     ix;
+    void         **p_link;
+    OS_MEM        *p_mem;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_slab == (OS_MEM_SLAB *)0) {                       /* Must point to a valid slab control block               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_addr == (void *)0) {                              /* Must pass a valid address for the storage area         */
+       *p_err = OS_ERR_MEM_INVALID_P_ADDR;
+        return;
+    }
+    align_msk = sizeof(void *) - 1u;
+    if (((CPU_ADDR)p_addr & align_msk) != 0u) {             /* Must be pointer size aligned                           */
+       *p_err = OS_ERR_MEM_INVALID_P_ADDR;
+        return;
+    }
+    if (p_nbr_blks_tbl == (OS_MEM_QTY const *)0) {          /* Must pass a table of block counts                      */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    nbr_blks_tot = (OS_MEM_QTY)0;
+    for (ix = 0u; ix < OS_MEM_SLAB_NBR_CLASS; ix++) {
+        if (p_nbr_blks_tbl[ix] == (OS_MEM_QTY)1) {          /* A partition must have at least 2 blocks                */
+           *p_err = OS_ERR_MEM_INVALID_BLKS;
+            return;
+        }
+        nbr_blks_tot += p_nbr_blks_tbl[ix];
+    }
+    if (nbr_blks_tot == (OS_MEM_QTY)0) {                    /* Must have at least one non-empty class                 */
+       *p_err = OS_ERR_MEM_INVALID_BLKS;
+        return;
+    }
+#endif
+
+    p_blk = (CPU_INT08U *)p_addr;
+    for (ix = 0u; ix < OS_MEM_SLAB_NBR_CLASS; ix++) {       /* Build the free list of each class                      */
+        p_mem    = &p_slab->Class[ix];
+        n_blks   =  p_nbr_blks_tbl[ix];
+        blk_size = (OS_MEM_SIZE)(OS_MEM_SLAB_BLK_SIZE_MIN << ix);
+        if (n_blks == (OS_MEM_QTY)0) {
+            p_mem->AddrPtr     = (void *)0;
+            p_mem->FreeListPtr = (void *)0;
+        } else {
+            p_mem->AddrPtr     = (void *)p_blk;
+            p_mem->FreeListPtr = (void *)p_blk;
+            p_link             = (void **)(void *)p_blk;
+            for (i = 1u; i < n_blks; i++) {
+                p_blk  +=  blk_size;
+               *p_link  = (void  *)p_blk;                   /* Save pointer to NEXT block in CURRENT block            */
+                p_link  = (void **)(void *)p_blk;           /* Position     to NEXT block                             */
+            }
+           *p_link  = (void *)0;                            /* Last memory block points to NULL                       */
+            p_blk  +=  blk_size;
+        }
+#if OS_OBJ_TYPE_REQ > 0u
+        p_mem->Type    = OS_OBJ_TYPE_MEM;
+#endif
+#if OS_CFG_DBG_EN > 0u
+        p_mem->NamePtr = p_name;
+#endif
+        p_mem->BlkSize = blk_size;
+        p_mem->NbrMax  = n_blks;
+        p_mem->NbrFree = n_blks;
+        p_slab->AddrEndPtr[ix]     = (void *)p_blk;         /* Classes are contiguous: end of this class = next start */
+        p_slab->NbrUsedMax[ix]     = (OS_MEM_QTY)0;
+        p_slab->NbrFallbackCtr[ix] = (OS_CTR)0;
+        p_slab->NbrFailCtr[ix]     = (OS_CTR)0;
+    }
+
+    OS_CRITICAL_ENTER();
+#if OS_OBJ_TYPE_REQ > 0u
+    p_slab->Type    = OS_OBJ_TYPE_MEM_SLAB;                 /* Set the type of object                                 */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_slab->NamePtr = p_name;                               /* Save name of slab                                      */
+#else
+    (void)&p_name;
+#endif
+    p_slab->AddrPtr = p_addr;                               /* Store start address of storage area                    */
+    OS_CRITICAL_EXIT_NO_SCHED();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               GET A BLOCK FROM A SLAB
+*
+* Description : Get a memory block of at least 'size' bytes from a slab.  The block is taken from the smallest class
+*               that fits; if that class is exhausted, the next larger non-empty class is used instead.
+*
+* Arguments   : p_slab  is a pointer to the slab control block
+*
+*               size    is the number of bytes requested (1 to OS_MEM_SLAB_BLK_SIZE_MAX)
+*
+*               p_err   is a pointer to a variable containing an error message which will be set by this function to
+*                       either:
+*
+*                       OS_ERR_NONE               if a block was allocated.
+*                       OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_slab'
+*                       OS_ERR_MEM_INVALID_SIZE   if 'size' is 0 or larger than OS_MEM_SLAB_BLK_SIZE_MAX
+*                       OS_ERR_MEM_NO_FREE_BLKS   if neither the class nor any larger class has a free block
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : (1) The failure counter is kept for the class that 'size' maps to, so that each class can be sized
+*                   from the observed demand.  A request served by a larger class is counted in .NbrFallbackCtr[] of
+*                   the requested class, while .NbrUsedMax[] tracks the blocks used in the class that served it.
+*
+*               (2) 'size' is checked against OS_MEM_SLAB_BLK_SIZE_MAX even when OS_CFG_ARG_CHK_EN is 0, since the
+*                   class it maps to indexes the counters of the slab.
+************************************************************************************************************************
+*/
+
+void  *OSMemSlabGet (OS_MEM_SLAB  *p_slab,
+                     OS_MEM_SIZE   size,
+                     OS_ERR       *p_err)
+{
+    OS_MEM      *p_mem;
+    void        *p_blk;
+    OS_MEM_QTY   nbr_used;
+    CPU_INT08U   ix_req;
+    CPU_INT08U   ix;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_slab == (OS_MEM_SLAB *)0) {                       /* Must point to a valid slab                             */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return ((void *)0);
+    }
+    if (size == (OS_MEM_SIZE)0) {                           /* Must request at least 1 byte                           */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+#endif
+
+    ix_req = OS_MemSlabClassGet(size);
+    if (ix_req >= OS_MEM_SLAB_NBR_CLASS) {                  /* Larger than the largest class (see Note #2)            */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+
+    CPU_CRITICAL_ENTER();
+    for (ix = ix_req; ix < OS_MEM_SLAB_NBR_CLASS; ix++) {
+        p_mem = &p_slab->Class[ix];
+        if (p_mem->NbrFree > (OS_MEM_QTY)0) {
+            p_blk              = p_mem->FreeListPtr;        /* Point to next free memory block                        */
+            p_mem->FreeListPtr = *(void **)p_blk;           /* Adjust pointer to new free list                        */
+            p_mem->NbrFree--;
+            nbr_used           = p_mem->NbrMax - p_mem->NbrFree;
+            if (nbr_used > p_slab->NbrUsedMax[ix]) {        /* Track the peak number of blocks used                   */
+                p_slab->NbrUsedMax[ix] = nbr_used;
+            }
+            if (ix != ix_req) {
+                p_slab->NbrFallbackCtr[ix_req]++;
+            }
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_NONE;
+            return (p_blk);
+        }
+    }
+    p_slab->NbrFailCtr[ix_req]++;                           /* No class large enough has a free block                 */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+    return ((void *)0);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RELEASE A BLOCK TO A SLAB
+*
+* Description : Returns a memory block obtained with OSMemSlabGet() to the class it was taken from.
+*
+* Arguments   : p_slab   is a pointer to the slab control block
+*
+*               p_blk    is a pointer to the memory block being released.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the memory block was returned to the slab
+*                            OS_ERR_MEM_FULL           if the owning class is already full (block freed twice)
+*                            OS_ERR_MEM_INVALID_P_BLK  if 'p_blk' is NULL or does not point to a block of the slab
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_slab'
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+void  OSMemSlabPut (OS_MEM_SLAB  *p_slab,
+                    void         *p_blk,
+                    OS_ERR       *p_err)
+{
+    OS_MEM      *p_mem;
+    CPU_INT08U   ix;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_slab == (OS_MEM_SLAB *)0) {                       /* Must point to a valid slab                             */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_blk == (void *)0) {                               /* Must release a valid block                             */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    if ((CPU_ADDR)p_blk < (CPU_ADDR)p_slab->AddrPtr) {      /* Block must lie within the storage area                 */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    for (ix = 0u; ix < OS_MEM_SLAB_NBR_CLASS; ix++) {       /* Find owning class from the block address               */
+        if ((CPU_ADDR)p_blk < (CPU_ADDR)p_slab->AddrEndPtr[ix]) {
+            break;
+        }
+    }
+    if (ix >= OS_MEM_SLAB_NBR_CLASS) {                      /* Beyond the end of the largest class                    */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    p_mem = &p_slab->Class[ix];
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((((CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr) % p_mem->BlkSize) != 0u) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;                   /* Must point to the start of a block                     */
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_mem->NbrFree >= p_mem->NbrMax) {                  /* Make sure all blocks not already returned              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_FULL;
+        return;
+    }
+    *(void **)p_blk    = p_mem->FreeListPtr;                /* Insert released block into free block list             */
+    p_mem->FreeListPtr = p_blk;
+    p_mem->NbrFree++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           DETERMINE THE SIZE CLASS OF A REQUEST
+*
+* Description : Maps a request size to the index of the smallest class whose blocks can hold it.
+*
+* Arguments   : size     is the number of bytes requested
+*
+* Returns     : The class index (0 to OS_MEM_SLAB_NBR_CLASS - 1), or OS_MEM_SLAB_NBR_CLASS or more if 'size' is larger
+*               than OS_MEM_SLAB_BLK_SIZE_MAX
+*
+* Note(s)     : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*               (2) The class is the number of significant bits in (size - 1), less log2(OS_MEM_SLAB_BLK_SIZE_MIN),
+*                   computed with a single count-leading-zeros operation.
+************************************************************************************************************************
+*/
+
+CPU_INT08U  OS_MemSlabClassGet (OS_MEM_SIZE  size)
+{
+    CPU_DATA  nbr_bits;
+
+
+    if (size <= (OS_MEM_SIZE)OS_MEM_SLAB_BLK_SIZE_MIN) {
+        return (0u);
+    }
+    nbr_bits = (CPU_DATA)DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)size - 1u);
+    return ((CPU_INT08U)(nbr_bits - OS_MEM_SLAB_BLK_SIZE_MIN_SHIFT));
+}
+#endif
@@ -146,6 +146,9 @@ OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
         p_msg_q->NbrEntries     = (OS_MSG_QTY)0;            /* Flush the message queue                                */
 #if OS_CFG_DBG_EN > 0u
         p_msg_q->NbrEntriesMax  = (OS_MSG_QTY)0;
+#endif
+#if OS_CFG_Q_PRIO_EN > 0u
+        p_msg_q->PrioTbl        = (CPU_DATA  )0;
 #endif
         p_msg_q->InPtr          = (OS_MSG   *)0;
         p_msg_q->OutPtr         = (OS_MSG   *)0;
@@ -178,6 +181,9 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
     p_msg_q->NbrEntries     = (OS_MSG_QTY)0;
 #if OS_CFG_DBG_EN > 0u
     p_msg_q->NbrEntriesMax  = (OS_MSG_QTY)0;
+#endif
+#if OS_CFG_Q_PRIO_EN > 0u
+    p_msg_q->PrioTbl        = (CPU_DATA  )0;                /* .PrioTailPtr[] entries are only valid when set here    */
 #endif
     p_msg_q->InPtr          = (OS_MSG   *)0;
     p_msg_q->OutPtr         = (OS_MSG   *)0;
@@ -241,6 +247,12 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
        *p_ts  = p_msg->MsgTS;
     }
 
+#if OS_CFG_Q_PRIO_EN > 0u
+    if (p_msg_q->PrioTailPtr[p_msg->MsgPrio] == p_msg) {    /* Was it the last message of its priority?               */
+        DEF_BIT_CLR(p_msg_q->PrioTbl, (CPU_DATA)DEF_BIT(p_msg->MsgPrio));
+    }
+#endif
+
     p_msg_q->OutPtr = p_msg->NextPtr;                       /* Point to next message to extract                       */
 
     if (p_msg_q->OutPtr == (OS_MSG *)0) {                   /* Are there any more messages in the queue?              */
@@ -278,6 +290,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 *                              OS_OPT_POST_FIFO
 *                              OS_OPT_POST_LIFO
 *
+*                          and, with OS_CFG_Q_PRIO_EN, may add OS_OPT_POST_PRIO with the priority of the message in
+*                          the OS_OPT_POST_PRIO_MASK bits (see Note #2).
+*
 *              ts          is a timestamp as to when the message was posted
 *
 *              p_err       is a pointer to a variable that will contain an error code returned by this function.
@@ -289,6 +304,15 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_Q_PRIO_EN, the queue is kept as one list made of consecutive sub-FIFOs, one per message
+*                 priority, highest priority first.  .PrioTbl tells which priorities hold messages and .PrioTailPtr[]
+*                 points to the last message of each, so a message is linked in after the last message of the
+*                 nearest priority above (or equal to, for FIFO) its own without walking the list.  OS_MsgQGet() is
+*                 unchanged: the highest priority message is always at the front.
+*
+*                 A message posted without OS_OPT_POST_PRIO is given the lowest priority when posted FIFO and the
+*                 highest when posted LIFO, which is how the queue behaves without OS_CFG_Q_PRIO_EN.
 ************************************************************************************************************************
 */
 
@@ -299,8 +323,12 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
                   CPU_TS        ts,
                   OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG    *p_msg;
+    OS_MSG    *p_msg_in;
+#if OS_CFG_Q_PRIO_EN > 0u
+    OS_PRIO    prio;
+    CPU_DATA   tbl;
+#endif
 
 
 
@@ -332,6 +360,46 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
     }
 #endif
 
+#if OS_CFG_Q_PRIO_EN > 0u                                   /* See Note #2                                            */
+    if ((opt & OS_OPT_POST_PRIO) != (OS_OPT)0) {
+        prio = (OS_PRIO)((opt & OS_OPT_POST_PRIO_MASK) >> OS_OPT_POST_PRIO_SHIFT);
+    } else if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {
+        prio = (OS_PRIO)(OS_CFG_Q_PRIO_LEVELS - 1u);
+    } else {
+        prio = (OS_PRIO)0;
+    }
+
+    if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {     /* FIFO: after the messages of priority 0 to 'prio'       */
+        tbl = p_msg_q->PrioTbl & (DEF_INT_CPU_U_MAX_VAL >> (DEF_INT_CPU_NBR_BITS - 1u - prio));
+    } else if (prio > (OS_PRIO)0) {                         /* LIFO: after the messages of priority 0 to 'prio' - 1   */
+        tbl = p_msg_q->PrioTbl & (DEF_INT_CPU_U_MAX_VAL >> (DEF_INT_CPU_NBR_BITS - prio));
+    } else {
+        tbl = (CPU_DATA)0;
+    }
+
+    if (tbl == (CPU_DATA)0) {                               /* Nothing to go after, insert at the front               */
+        p_msg->NextPtr         = p_msg_q->OutPtr;
+        p_msg_q->OutPtr        = p_msg;
+        if (p_msg_q->NbrEntries == (OS_MSG_QTY)0) {
+            p_msg_q->InPtr     = p_msg;
+        }
+    } else {                                                /* Insert after the last message of the nearest priority  */
+        p_msg_in               = p_msg_q->PrioTailPtr[(DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros(tbl)];
+        p_msg->NextPtr         = p_msg_in->NextPtr;
+        p_msg_in->NextPtr      = p_msg;
+        if (p_msg_q->InPtr == p_msg_in) {
+            p_msg_q->InPtr     = p_msg;
+        }
+    }
+
+    if (((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) ||   /* New last message of its priority?                      */
+        ((p_msg_q->PrioTbl & (CPU_DATA)DEF_BIT(prio)) == (CPU_DATA)0)) {
+        p_msg_q->PrioTailPtr[prio] = p_msg;
+        DEF_BIT_SET(p_msg_q->PrioTbl, (CPU_DATA)DEF_BIT(prio));
+    }
+    p_msg->MsgPrio = prio;
+    p_msg_q->NbrEntries++;
+#else
     if (p_msg_q->NbrEntries == (OS_MSG_QTY)0) {             /* Is this first message placed in the queue?             */
         p_msg_q->InPtr         = p_msg;                     /* Yes                                                    */
         p_msg_q->OutPtr        = p_msg;
@@ -349,6 +417,7 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         }
         p_msg_q->NbrEntries++;
     }
+#endif
 
 #if OS_CFG_DBG_EN > 0u
     if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
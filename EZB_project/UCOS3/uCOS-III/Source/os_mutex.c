@@ -115,6 +115,10 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->OwnerTCBPtr       = (OS_TCB       *)0;
     p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)0;         /* Mutex is available                                     */
     p_mutex->TS                = (CPU_TS        )0;
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    p_mutex->Opt               =  OS_OPT_MUTEX_NONE;        /* Default to priority inheritance                        */
+    p_mutex->PrioCeil          = (OS_PRIO       )0;
+#endif
     OS_PendListInit(&p_mutex->PendList);                    /* Initialize the waiting list                            */
 
 #if OS_CFG_DBG_EN > 0u
@@ -132,6 +136,102 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 }
 
 
+/*
+************************************************************************************************************************
+*                                           CREATE A MUTEX WITH OPTIONS
+*
+* Description: This function creates a mutex and selects the protocol used to bound priority inversion.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              prio_ceil     is the ceiling priority of the mutex.  It must be at least as high (i.e. numerically
+*                            lower or equal) as the base priority of every task that will ever pend on the mutex.
+*                            This argument is ignored unless 'opt' is OS_OPT_MUTEX_CEILING.
+*
+*              opt           selects the protocol:
+*
+*                                OS_OPT_MUTEX_NONE              Priority inheritance, same as OSMutexCreate()
+*                                OS_OPT_MUTEX_CEILING           Immediate priority ceiling (see Note #1)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_OPT_INVALID             if you specified an invalid option
+*                                OS_ERR_PRIO_INVALID            if 'prio_ceil' is a reserved or out of range priority
+*                                (see OSMutexCreate() for the other error codes)
+*
+* Returns    : none
+*
+* Note(s)    : 1) With OS_OPT_MUTEX_CEILING the owner is raised to 'prio_ceil' as soon as it acquires the mutex and
+*                 drops back when it releases it.  No priority is ever inherited through the mutex, so neither
+*                 OSMutexPend() nor OSMutexPost() walks the owner chain or re-sorts a pend list: acquiring only moves
+*                 the running task to another ready list and releasing only recomputes its priority from the other
+*                 mutexes it still holds (nothing when ceiling mutexes are not nested).
+*
+*              2) A task whose base priority is higher than 'prio_ceil' is refused with OS_ERR_MUTEX_CEILING when it
+*                 pends on the mutex.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+void  OSMutexCreateExt (OS_MUTEX  *p_mutex,
+                        CPU_CHAR  *p_name,
+                        OS_PRIO    prio_ceil,
+                        OS_OPT     opt,
+                        OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_MUTEX_NONE:
+        case OS_OPT_MUTEX_CEILING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if (opt == OS_OPT_MUTEX_CEILING) {
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+        if (prio_ceil == (OS_PRIO)0) {                      /* Priority 0 is reserved for the ISR handler task        */
+           *p_err = OS_ERR_PRIO_INVALID;
+            return;
+        }
+#endif
+        if (prio_ceil >= (OS_CFG_PRIO_MAX - 1u)) {          /* Cannot use the idle task priority                      */
+           *p_err = OS_ERR_PRIO_INVALID;
+            return;
+        }
+    }
+
+    OSMutexCreate(p_mutex, p_name, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_mutex->Opt      = opt;
+    p_mutex->PrioCeil = prio_ceil;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A MUTEX
@@ -325,6 +425,8 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEILING      If the caller's base priority is higher than the ceiling
+*                                                          of a priority-ceiling mutex
 *                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
 *                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
 *                                OS_ERR_OBJ_PTR_NULL       If 'p_mutex' is a NULL pointer.
@@ -413,6 +515,17 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 
     CPU_CRITICAL_ENTER();
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if ((p_mutex->Opt == OS_OPT_MUTEX_CEILING) &&
+        (OSTCBCurPtr->BasePrio < p_mutex->PrioCeil)) {      /* Caller must not be above the ceiling                   */
+        CPU_CRITICAL_EXIT();
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+        TRACE_OS_MUTEX_PEND_FAILED(p_mutex);                /* Record the event.                                      */
+#endif
+       *p_err = OS_ERR_MUTEX_CEILING;
+        return;
+    }
+#endif
     if (p_mutex->OwnerNestingCtr == (OS_NESTING_CTR)0) {    /* Resource available?                                    */
         p_mutex->OwnerTCBPtr       =  OSTCBCurPtr;          /* Yes, caller may proceed                                */
         p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)1;
@@ -420,6 +533,19 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
            *p_ts  = p_mutex->TS;
         }
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);               /* Add mutex to owner's group                             */
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+        if ((p_mutex->Opt      == OS_OPT_MUTEX_CEILING) &&
+            (p_mutex->PrioCeil <  OSTCBCurPtr->Prio)) {     /* Raise the owner to the ceiling right away              */
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = p_mutex->PrioCeil;
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+            TRACE_OS_MUTEX_TASK_PRIO_INHERIT(OSTCBCurPtr, OSTCBCurPtr->Prio);
+#endif
+            OS_PrioInsert(OSTCBCurPtr->Prio);
+            OS_RdyListInsertHead(OSTCBCurPtr);              /* Still the running task, keep it first at its prio      */
+            OSPrioCur         = OSTCBCurPtr->Prio;
+        }
+#endif
         CPU_CRITICAL_EXIT();
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
         TRACE_OS_MUTEX_PEND(p_mutex);                       /* Record the event.                                      */
@@ -461,7 +587,12 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
                                                             /* Lock the scheduler/re-enable interrupts                */
     OS_CRITICAL_ENTER_CPU_EXIT();
     p_tcb = p_mutex->OwnerTCBPtr;                           /* Point to the TCB of the Mutex owner                    */
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if ((p_mutex->Opt != OS_OPT_MUTEX_CEILING) &&           /* A ceiling owner already runs at the ceiling            */
+        (p_tcb->Prio   > OSTCBCurPtr->Prio)) {
+#else
     if (p_tcb->Prio > OSTCBCurPtr->Prio) {                  /* See if mutex owner has a lower priority than current   */
+#endif
         OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
 #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
                  TRACE_OS_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
@@ -783,10 +914,38 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                /* Remove mutex from owner's group                        */
 
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if ((p_mutex->Opt      == OS_OPT_MUTEX_CEILING) &&
+        (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio)) {     /* Drop the ceiling                                       */
+        prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr); /* Only needed by the mutexes the owner still holds       */
+        prio_new = prio_new > OSTCBCurPtr->BasePrio ? OSTCBCurPtr->BasePrio : prio_new;
+        if (prio_new > OSTCBCurPtr->Prio) {
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = prio_new;
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+            TRACE_OS_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
+#endif
+            OS_PrioInsert(prio_new);
+            OS_RdyListInsertTail(OSTCBCurPtr);
+            OSPrioCur         = prio_new;
+        }
+    }
+#endif
+
     p_pend_list = &p_mutex->PendList;
     if (p_pend_list->NbrEntries == (OS_OBJ_QTY)0) {         /* Any task waiting on mutex?                             */
         p_mutex->OwnerTCBPtr     = (OS_TCB       *)0;       /* No                                                     */
         p_mutex->OwnerNestingCtr = (OS_NESTING_CTR)0;
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+        if (p_mutex->Opt == OS_OPT_MUTEX_CEILING) {         /* Owner may now be below a ready task                    */
+            OS_CRITICAL_EXIT_NO_SCHED();
+            if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+                OSSched();
+            }
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+#endif
         OS_CRITICAL_EXIT();
        *p_err = OS_ERR_NONE;
         return;
@@ -811,6 +970,12 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     p_mutex->OwnerTCBPtr       = p_tcb;                     /* Give mutex to new owner                                */
     p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)1;
     OS_MutexGrpAdd(p_tcb, p_mutex);
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if ((p_mutex->Opt      == OS_OPT_MUTEX_CEILING) &&
+        (p_mutex->PrioCeil <  p_tcb->Prio)) {               /* New owner is readied directly at the ceiling           */
+        p_tcb->Prio = p_mutex->PrioCeil;
+    }
+#endif
                                                             /* Post to mutex                                          */
     OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
             (OS_TCB      *)p_tcb,
@@ -856,6 +1021,10 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->OwnerTCBPtr       = (OS_TCB       *)0;
     p_mutex->OwnerNestingCtr   = (OS_NESTING_CTR)0;
     p_mutex->TS                = (CPU_TS        )0;
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    p_mutex->Opt               =  OS_OPT_MUTEX_NONE;
+    p_mutex->PrioCeil          = (OS_PRIO       )0;
+#endif
     OS_PendListInit(&p_mutex->PendList);                    /* Initialize the waiting list                            */
 }
 
@@ -1018,6 +1187,8 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 *                                              MUTEX FIND HIGHEST PENDING
 *
 * Description: This function is called by the kernel to find the highest task pending on any mutex from a group.
+*              The ceiling of a priority-ceiling mutex in the group counts as a pending priority, and so do the tasks
+*              waiting on a reader-writer lock the task owns for writing.
 *
 
 * Argument(s): p_tcb        is a pointer to the tcb of the task to process.
@@ -1041,6 +1212,14 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
     while(*pp_mutex != (OS_MUTEX *)0) {
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+        if ((*pp_mutex)->Opt == OS_OPT_MUTEX_CEILING) {
+            prio = (*pp_mutex)->PrioCeil;
+            if(prio < highest_prio) {
+                highest_prio = prio;
+            }
+        }
+#endif
         p_head = (*pp_mutex)->PendList.HeadPtr;
         if (p_head!= (OS_PEND_DATA *)0) {
             prio = p_head->TCBPtr->Prio;
@@ -1051,6 +1230,13 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
         pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
     }
 
+#if OS_CFG_RWLOCK_EN > 0u
+    prio = OS_RWLockGrpPrioFindHighest(p_tcb);
+    if(prio < highest_prio) {
+        highest_prio = prio;
+    }
+#endif
+
     return (highest_prio);
 }
 
@@ -1104,6 +1290,12 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
             p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+            if ((p_mutex->Opt      == OS_OPT_MUTEX_CEILING) &&
+                (p_mutex->PrioCeil <  p_tcb_new->Prio)) {       /* New owner is readied directly at the ceiling         */
+                p_tcb_new->Prio = p_mutex->PrioCeil;
+            }
+#endif
                                                                 /* Post to mutex                                        */
             OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
                                             p_tcb_new,
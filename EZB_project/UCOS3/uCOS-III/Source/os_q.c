@@ -123,6 +123,9 @@ void  OSQCreate (OS_Q        *p_q,
 #endif
     OS_MsgQInit(&p_q->MsgQ,                                 /* Initialize the queue                                   */
                 max_qty);
+#if OS_CFG_WAIT_SET_EN > 0u
+    p_q->WaitSetEntryPtr = (OS_WAIT_SET_ENTRY *)0;          /* Not registered in a wait set                           */
+#endif
     OS_PendListInit(&p_q->PendList);                        /* Initialize the waiting list                            */
 
 #if OS_CFG_DBG_EN > 0u
@@ -739,6 +742,9 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *                                OS_ERR_Q_MAX           If the queue is full
 *
 * Returns    : None
+*
+* Note(s)    : 1) With OS_CFG_Q_PRIO_EN, a message posted FIFO goes behind all the messages in the queue, including
+*                 those posted with OSQPostPrio().
 ************************************************************************************************************************
 */
 
@@ -749,6 +755,9 @@ void  OSQPost (OS_Q         *p_q,
                OS_ERR       *p_err)
 {
     CPU_TS  ts;
+#if (OS_CFG_ARG_CHK_EN > 0u) && (OS_CFG_Q_PRIO_EN > 0u)
+    OS_OPT  opt_chk;
+#endif
 
 
 
@@ -770,7 +779,22 @@ void  OSQPost (OS_Q         *p_q,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
+#if OS_CFG_Q_PRIO_EN > 0u
+    opt_chk = opt;
+    if ((opt & OS_OPT_POST_PRIO) != (OS_OPT)0) {            /* Validate the priority set by OSQPostPrio()             */
+        if (((opt & OS_OPT_POST_PRIO_MASK) >> OS_OPT_POST_PRIO_SHIFT) >= OS_CFG_Q_PRIO_LEVELS) {
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+            TRACE_OS_Q_POST_FAILED(p_q);                    /* Record the event.                                      */
+#endif
+           *p_err = OS_ERR_Q_PRIO_INVALID;
+            return;
+        }
+        opt_chk &= (OS_OPT)~(OS_OPT_POST_PRIO | OS_OPT_POST_PRIO_MASK);
+    }
+    switch (opt_chk) {                                      /* Validate 'opt'                                         */
+#else
     switch (opt) {                                          /* Validate 'opt'                                         */
+#endif
         case OS_OPT_POST_FIFO:
         case OS_OPT_POST_LIFO:
         case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
@@ -827,6 +851,83 @@ void  OSQPost (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                         POST MESSAGE WITH A PRIORITY TO A QUEUE
+*
+* Description: This function sends a message with a priority to a queue.  Messages are retrieved highest priority
+*              first and, within a priority, in the order selected by 'opt'.  Control messages can so overtake bulk
+*              traffic already queued.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              prio          is the priority of the message, from 0 (the highest) to OS_CFG_Q_PRIO_LEVELS - 1 (the
+*                            lowest, that of messages posted FIFO with OSQPost()).
+*
+*              opt           determines the type of POST performed, as for OSQPost():
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.
+*                                OS_OPT_POST_FIFO         POST message behind the messages of the same priority
+*                                OS_OPT_POST_LIFO         POST message ahead of the messages of the same priority
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE            The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY  If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_PTR_NULL    If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE        If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID     If 'opt' is not valid
+*                                OS_ERR_Q_MAX           If the queue is full
+*                                OS_ERR_Q_PRIO_INVALID  If 'prio' is not below OS_CFG_Q_PRIO_LEVELS
+*
+* Returns    : None
+*
+* Note(s)    : 1) A message handed directly to a waiting task is not queued, so its priority does not matter.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_Q_PRIO_EN > 0u
+void  OSQPostPrio (OS_Q         *p_q,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_PRIO       prio,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (prio >= (OS_PRIO)OS_CFG_Q_PRIO_LEVELS) {            /* Validate 'prio'                                        */
+       *p_err = OS_ERR_Q_PRIO_INVALID;
+        return;
+    }
+    if ((opt & (OS_OPT_POST_PRIO | OS_OPT_POST_PRIO_MASK)) != (OS_OPT)0) {
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+
+    opt |= OS_OPT_POST_PRIO;                                /* Carry the priority to OS_MsgQPut() in 'opt'            */
+    opt |= (OS_OPT)((OS_OPT)prio << OS_OPT_POST_PRIO_SHIFT);
+    OSQPost(p_q,
+            p_void,
+            msg_size,
+            opt,
+            p_err);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
@@ -846,6 +947,11 @@ void  OSQPost (OS_Q         *p_q,
 void  OS_QClr (OS_Q  *p_q)
 {
     (void)OS_MsgQFreeAll(&p_q->MsgQ);                       /* Return all OS_MSGs to the free list                    */
+#if OS_CFG_WAIT_SET_EN > 0u
+    if (p_q->WaitSetEntryPtr != (OS_WAIT_SET_ENTRY *)0) {   /* Leave the wait set                                     */
+        OS_WaitSetEntryRemove(p_q->WaitSetEntryPtr);
+    }
+#endif
 #if OS_OBJ_TYPE_REQ > 0u
     p_q->Type    =  OS_OBJ_TYPE_NONE;                       /* Mark the data structure as a NONE                      */
 #endif
@@ -1019,12 +1125,26 @@ void  OS_QPost (OS_Q         *p_q,
         } else {
             post_type = OS_OPT_POST_LIFO;
         }
+#if OS_CFG_Q_PRIO_EN > 0u                                   /* Keep the message priority                              */
+        post_type |= opt & (OS_OPT_POST_PRIO | OS_OPT_POST_PRIO_MASK);
+#endif
         OS_MsgQPut(&p_q->MsgQ,                              /* Place message in the message queue                     */
                    p_void,
                    msg_size,
                    post_type,
                    ts,
                    p_err);
+#if OS_CFG_WAIT_SET_EN > 0u
+        if ((*p_err               == OS_ERR_NONE) &&
+            (p_q->WaitSetEntryPtr != (OS_WAIT_SET_ENTRY *)0)) {
+            OS_WaitSetSignal(p_q->WaitSetEntryPtr);         /* Notify the wait set the queue is registered in         */
+            OS_CRITICAL_EXIT_NO_SCHED();
+            if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+                OSSched();                                  /* Run the scheduler                                      */
+            }
+            return;
+        }
+#endif
         OS_CRITICAL_EXIT();
         return;
     }
@@ -0,0 +1,1003 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                             READER-WRITER LOCK MANAGEMENT
+*
+* File    : OS_RWLOCK.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) Any number of readers may hold the lock at the same time; a writer holds it alone.  Readers and
+*               writers wait in the same priority-ordered pend list and are told apart by their TCB's .PendOn.
+*
+*           (2) Writers have preference: a reader blocks while a writer owns the lock OR waits for it, and a release
+*               hands the lock to the highest priority waiting writer before any reader.  Readers are all readied
+*               together once no writer is left waiting.
+*
+*           (3) A task blocked by the owning writer lends its priority to that writer.  As for a mutex owner, the
+*               writer keeps it until it releases the lock or the task stops waiting (timeout, deletion or a lower
+*               priority).  Readers are not tracked individually and do not inherit.
+*
+*           (4) Locks are not recursive.  A writer pending again on its own lock gets OS_ERR_RWLOCK_OWNER.  A reader
+*               that requests the write lock without releasing its read lock deadlocks.
+*
+*           (5) A task deleted while it owns the write lock releases it (see OS_RWLockGrpPostAll()).  Read locks are
+*               only counted, so a task MUST NOT be deleted while it holds one.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rwlock__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_RWLOCK_EN > 0u
+/*
+************************************************************************************************************************
+*                                              CREATE A READER-WRITER LOCK
+*
+* Description: This function creates a reader-writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the lock to initialize.  Your application is responsible for allocating
+*                            storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_CREATE_ISR              if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart().
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_rwlock' is a NULL pointer
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockCreate (OS_RWLOCK  *p_rwlock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_rwlock == (OS_RWLOCK *)0) {                       /* Validate 'p_rwlock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+#if OS_OBJ_TYPE_REQ > 0u
+    p_rwlock->Type        =  OS_OBJ_TYPE_RWLOCK;            /* Mark the data structure as a reader-writer lock        */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_rwlock->NamePtr     =  p_name;
+#else
+    (void)&p_name;
+#endif
+    p_rwlock->RWLockGrpNextPtr = (OS_RWLOCK *)0;
+    p_rwlock->OwnerTCBPtr      = (OS_TCB    *)0;            /* No writer ...                                          */
+    p_rwlock->RdCtr            = (OS_OBJ_QTY)0;             /* ... and no reader                                      */
+    p_rwlock->WrWaitCtr        = (OS_OBJ_QTY)0;
+    p_rwlock->TS               = (CPU_TS    )0;
+    OS_PendListInit(&p_rwlock->PendList);                   /* Initialize the waiting list                            */
+    OS_CRITICAL_EXIT_NO_SCHED();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              DELETE A READER-WRITER LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on it.
+*
+* Arguments  : p_rwlock      is a pointer to the lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR              If you attempted to delete the lock from an ISR
+*                                OS_ERR_OBJ_PTR_NULL         If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE             If 'p_rwlock' is not pointing to a reader-writer lock
+*                                OS_ERR_OPT_INVALID          An invalid option was specified
+*                                OS_ERR_TASK_WAITING         One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) Tasks pending on the lock get OS_ERR_OBJ_DEL.  A writer that owned the lock loses any priority it
+*                 inherited through it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_RWLOCK_DEL_EN > 0u
+OS_OBJ_QTY  OSRWLockDel (OS_RWLOCK  *p_rwlock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb_owner;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to delete a lock from an ISR               */
+       *p_err = OS_ERR_DEL_ISR;
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_rwlock == (OS_RWLOCK *)0) {                       /* Validate 'p_rwlock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_OBJ_QTY)0);
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_DEL_NO_PEND:
+        case OS_OPT_DEL_ALWAYS:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {             /* Make sure the lock was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+    p_pend_list = &p_rwlock->PendList;
+    nbr_tasks   =  p_pend_list->NbrEntries;
+    if ((opt == OS_OPT_DEL_NO_PEND) && (nbr_tasks > (OS_OBJ_QTY)0)) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_WAITING;
+        return (nbr_tasks);
+    }
+
+    ts = OS_TS_GET();                                       /* Get timestamp                                          */
+    while (p_pend_list->NbrEntries > (OS_OBJ_QTY)0) {       /* Ready all the tasks pending on the lock                */
+        OS_PendObjDel((OS_PEND_OBJ *)((void *)p_rwlock),
+                      p_pend_list->HeadPtr->TCBPtr,
+                      ts);
+    }
+
+    p_tcb_owner = p_rwlock->OwnerTCBPtr;
+    if (p_tcb_owner != (OS_TCB *)0) {                       /* Drop what the writer inherited through the lock        */
+        OS_RWLockGrpRemove(p_tcb_owner, p_rwlock);
+        OS_RWLockPrioRestore(p_tcb_owner);
+    }
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_rwlock->Type        =  OS_OBJ_TYPE_NONE;              /* Mark the data structure as a NONE                      */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_rwlock->NamePtr     = (CPU_CHAR  *)((void *)"?RWLOCK");
+#endif
+    p_rwlock->RWLockGrpNextPtr = (OS_RWLOCK *)0;
+    p_rwlock->OwnerTCBPtr      = (OS_TCB    *)0;
+    p_rwlock->RdCtr            = (OS_OBJ_QTY)0;
+    p_rwlock->WrWaitCtr        = (OS_OBJ_QTY)0;
+    p_rwlock->TS               = (CPU_TS    )0;
+    OS_PendListInit(&p_rwlock->PendList);
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();                                              /* Find highest priority task ready to run                */
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             PEND ON A READER-WRITER LOCK
+*
+* Description: OSRWLockPendRd() acquires the lock for reading (shared) and OSRWLockPendWr() acquires it for writing
+*              (exclusive).
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or until the lock is available.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was released
+*                            or deleted.  You can pass a NULL pointer if you don't need it.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task holds the lock
+*                                OS_ERR_OBJ_DEL            If 'p_rwlock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_RWLOCK_OWNER       If the calling task already owns the lock for writing
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The lock was not obtained within the specified timeout.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockPendRd (OS_RWLOCK  *p_rwlock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+    OS_RWLockPend(p_rwlock,
+                  timeout,
+                  opt,
+                  OS_TASK_PEND_ON_RWLOCK_RD,
+                  p_ts,
+                  p_err);
+}
+
+
+void  OSRWLockPendWr (OS_RWLOCK  *p_rwlock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+    OS_RWLockPend(p_rwlock,
+                  timeout,
+                  opt,
+                  OS_TASK_PEND_ON_RWLOCK_WR,
+                  p_ts,
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           RELEASE A READER-WRITER LOCK
+*
+* Description: OSRWLockPostRd() releases a read lock and OSRWLockPostWr() releases the write lock.  When the last
+*              holder leaves, the lock is handed to the highest priority waiting writer or, if there is none, to all
+*              waiting readers.
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE          No special option selected
+*                                OS_OPT_POST_NO_SCHED      If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*                                OS_ERR_RWLOCK_NOT_OWNER   If the lock is not held for reading (OSRWLockPostRd()) or
+*                                                          the calling task is not the writer (OSRWLockPostWr())
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockPostRd (OS_RWLOCK  *p_rwlock,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    OS_RWLockPost(p_rwlock,
+                  opt,
+                  OS_TASK_PEND_ON_RWLOCK_RD,
+                  p_err);
+}
+
+
+void  OSRWLockPostWr (OS_RWLOCK  *p_rwlock,
+                      OS_OPT      opt,
+                      OS_ERR     *p_err)
+{
+    OS_RWLockPost(p_rwlock,
+                  opt,
+                  OS_TASK_PEND_ON_RWLOCK_WR,
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          PEND ON A READER-WRITER LOCK (COMMON)
+*
+* Description: This function implements OSRWLockPendRd() and OSRWLockPendWr().
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+*              timeout       is the timeout period (in clock ticks), 0 to wait forever
+*
+*              opt           is OS_OPT_PEND_BLOCKING or OS_OPT_PEND_NON_BLOCKING
+*
+*              mode          is OS_TASK_PEND_ON_RWLOCK_RD or OS_TASK_PEND_ON_RWLOCK_WR
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp, may be NULL
+*
+*              p_err         is a pointer to a variable that will contain an error code (see OSRWLockPendRd())
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockPend (OS_RWLOCK  *p_rwlock,
+                     OS_TICK     timeout,
+                     OS_OPT      opt,
+                     OS_STATE    mode,
+                     CPU_TS     *p_ts,
+                     OS_ERR     *p_err)
+{
+    OS_PEND_DATA  pend_data;
+    OS_TCB       *p_tcb;
+    CPU_BOOLEAN   avail;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_rwlock == (OS_RWLOCK *)0) {                       /* Validate arguments                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {             /* Make sure the lock was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_rwlock->OwnerTCBPtr;
+    if (p_tcb == OSTCBCurPtr) {                             /* Writer pending again on its own lock?                  */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RWLOCK_OWNER;
+        return;
+    }
+
+    avail = DEF_FALSE;
+    if (p_tcb == (OS_TCB *)0) {                             /* No writer holds the lock                               */
+        if (mode == OS_TASK_PEND_ON_RWLOCK_WR) {
+            if (p_rwlock->RdCtr == (OS_OBJ_QTY)0) {         /* Writers need it free of readers too                    */
+                p_rwlock->OwnerTCBPtr = OSTCBCurPtr;
+                OS_RWLockGrpAdd(OSTCBCurPtr, p_rwlock);
+                avail                 = DEF_TRUE;
+            }
+        } else {
+            if (p_rwlock->WrWaitCtr == (OS_OBJ_QTY)0) {
+                p_rwlock->RdCtr++;                          /* Readers only yield to waiting writers                  */
+                avail = DEF_TRUE;
+            }
+        }
+    }
+    if (avail == DEF_TRUE) {
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts  = p_rwlock->TS;
+        }
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {    /* Caller wants to block if not available?                */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                    /* No                                                     */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    /* Can't pend when the scheduler is locked                */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+                                                            /* Lock the scheduler/re-enable interrupts                */
+    OS_CRITICAL_ENTER_CPU_EXIT();
+    if ((p_tcb       != (OS_TCB *)0) &&                     /* Lend our priority to the writer holding the lock       */
+        (p_tcb->Prio >  OSTCBCurPtr->Prio)) {
+        OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
+    }
+    if (mode == OS_TASK_PEND_ON_RWLOCK_WR) {
+        p_rwlock->WrWaitCtr++;                              /* Readers arriving from now on queue behind us           */
+    }
+
+    OS_Pend(&pend_data,                                     /* Block task pending on the lock                         */
+            (OS_PEND_OBJ *)((void *)p_rwlock),
+             mode,
+             timeout);
+
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();                                              /* Find the next highest priority task ready to run       */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                             /* The lock was handed to us by OS_RWLockGrant()          */
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  = OSTCBCurPtr->TS;
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                        /* Indicate that we didn't get the lock within timeout    */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                            /* Indicate that the lock has been deleted                */
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts  = OSTCBCurPtr->TS;
+             }
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                        RELEASE A READER-WRITER LOCK (COMMON)
+*
+* Description: This function implements OSRWLockPostRd() and OSRWLockPostWr().
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+*              opt           is OS_OPT_POST_NONE or OS_OPT_POST_NO_SCHED
+*
+*              mode          is OS_TASK_PEND_ON_RWLOCK_RD or OS_TASK_PEND_ON_RWLOCK_WR
+*
+*              p_err         is a pointer to a variable that will contain an error code (see OSRWLockPostRd())
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockPost (OS_RWLOCK  *p_rwlock,
+                     OS_OPT      opt,
+                     OS_STATE    mode,
+                     OS_ERR     *p_err)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_rwlock == (OS_RWLOCK *)0) {                       /* Validate 'p_rwlock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {             /* Make sure the lock was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    ts = OS_TS_GET();                                       /* Get timestamp                                          */
+    CPU_CRITICAL_ENTER();
+    if (mode == OS_TASK_PEND_ON_RWLOCK_RD) {
+        if (p_rwlock->RdCtr == (OS_OBJ_QTY)0) {             /* Must be held for reading                               */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+            return;
+        }
+        p_rwlock->RdCtr--;
+        p_rwlock->TS = ts;
+        if ((p_rwlock->RdCtr               > (OS_OBJ_QTY)0) ||
+            (p_rwlock->PendList.NbrEntries == (OS_OBJ_QTY)0)) {   /* Other readers left, or nobody waiting?        */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+        OS_CRITICAL_ENTER_CPU_EXIT();
+    } else {
+        if (p_rwlock->OwnerTCBPtr != OSTCBCurPtr) {         /* Make sure the writer is releasing the lock             */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+            return;
+        }
+        OS_CRITICAL_ENTER_CPU_EXIT();
+        p_rwlock->OwnerTCBPtr = (OS_TCB *)0;
+        p_rwlock->TS          = ts;
+        OS_RWLockGrpRemove(OSTCBCurPtr, p_rwlock);
+        OS_RWLockPrioRestore(OSTCBCurPtr);                  /* Give back any priority inherited through the lock      */
+    }
+
+    if (p_rwlock->PendList.NbrEntries > (OS_OBJ_QTY)0) {
+        OS_RWLockGrant(p_rwlock, ts);                       /* Hand the lock to the waiting writer or readers         */
+    }
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+        OSSched();                                          /* Run the scheduler                                      */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          HAND A FREE LOCK TO ITS WAITERS
+*
+* Description: This function is called when a reader-writer lock becomes free while tasks are waiting on it.  The
+*              highest priority waiting writer gets the lock; if no writer is waiting, all waiting readers get it.
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+*              ts            is the timestamp of the release
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with the scheduler locked.
+*
+*              3) Readers queued ahead of the new writer now wait on it, so the writer is readied at the priority of
+*                 the highest one, as OS_RWLockPend() would have done had the writer owned the lock already.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockGrant (OS_RWLOCK  *p_rwlock,
+                      CPU_TS      ts)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_DATA  *p_pend_data_next;
+    OS_TCB        *p_tcb;
+    OS_PRIO        prio_head;
+
+
+
+    if (p_rwlock->WrWaitCtr > (OS_OBJ_QTY)0) {              /* Writer preference                                      */
+        p_pend_data           = OS_RWLockWrWaitGet(p_rwlock);
+        p_tcb                 = p_pend_data->TCBPtr;
+        p_rwlock->WrWaitCtr--;
+        p_rwlock->OwnerTCBPtr = p_tcb;
+        OS_RWLockGrpAdd(p_tcb, p_rwlock);
+        prio_head             = p_rwlock->PendList.HeadPtr->TCBPtr->Prio;
+        if (prio_head < p_tcb->Prio) {                      /* Inherit from the readers ahead of us (see Note #3)     */
+            p_tcb->Prio = prio_head;
+        }
+        OS_Post((OS_PEND_OBJ *)((void *)p_rwlock),
+                p_tcb,
+                (void      *)0,
+                (OS_MSG_SIZE)0,
+                ts);
+        return;
+    }
+
+    p_pend_data = p_rwlock->PendList.HeadPtr;               /* Only readers are waiting, let all of them in           */
+    while (p_pend_data != (OS_PEND_DATA *)0) {
+        p_pend_data_next = p_pend_data->NextPtr;
+        p_rwlock->RdCtr++;
+        OS_Post((OS_PEND_OBJ *)((void *)p_rwlock),
+                p_pend_data->TCBPtr,
+                (void      *)0,
+                (OS_MSG_SIZE)0,
+                ts);
+        p_pend_data = p_pend_data_next;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ADD A LOCK TO A WRITER'S GROUP
+*
+* Description: This function is called when a task becomes the writer of a lock.  The locks a task owns for writing
+*              are linked from its TCB so that its inherited priority can be recomputed and so that they can be
+*              released if the task is deleted.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+*              p_rwlock      is a pointer to the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockGrpAdd (OS_TCB     *p_tcb,
+                       OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->RWLockGrpNextPtr = p_tcb->RWLockGrpHeadPtr;   /* The group is not sorted, add to the head of the list   */
+    p_tcb->RWLockGrpHeadPtr    = p_rwlock;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE ALL THE LOCKS OF A WRITER
+*
+* Description: This function releases every lock a task owns for writing.  It is called when the task is deleted and
+*              hands each lock to its waiters as OSRWLockPostWr() would.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with the scheduler locked.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockGrpPostAll (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK  *p_rwlock;
+    OS_RWLOCK  *p_rwlock_next;
+    CPU_TS      ts;
+
+
+
+    ts       = OS_TS_GET();                                 /* Get timestamp                                          */
+    p_rwlock = p_tcb->RWLockGrpHeadPtr;
+    while (p_rwlock != (OS_RWLOCK *)0) {
+        p_rwlock_next              = p_rwlock->RWLockGrpNextPtr;
+        p_rwlock->RWLockGrpNextPtr = (OS_RWLOCK *)0;
+        p_rwlock->OwnerTCBPtr      = (OS_TCB    *)0;
+        p_rwlock->TS               = ts;
+        if (p_rwlock->PendList.NbrEntries > (OS_OBJ_QTY)0) {
+            OS_RWLockGrant(p_rwlock, ts);                   /* Hand the lock to the waiting writer or readers         */
+        }
+        p_rwlock = p_rwlock_next;
+    }
+    p_tcb->RWLockGrpHeadPtr = (OS_RWLOCK *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                     FIND THE HIGHEST PRIORITY WAITING ON A WRITER
+*
+* Description: This function finds the highest priority task waiting on any of the locks a task owns for writing.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+* Returns    : Highest priority waiting or OS_CFG_PRIO_MAX - 1u if none found.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_RWLockGrpPrioFindHighest (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK     *p_rwlock;
+    OS_PEND_DATA  *p_head;
+    OS_PRIO        highest_prio;
+
+
+
+    highest_prio = OS_CFG_PRIO_MAX - 1u;
+    p_rwlock     = p_tcb->RWLockGrpHeadPtr;
+    while (p_rwlock != (OS_RWLOCK *)0) {
+        p_head = p_rwlock->PendList.HeadPtr;                /* The pend list is sorted, its head is the highest       */
+        if ((p_head               != (OS_PEND_DATA *)0) &&
+            (p_head->TCBPtr->Prio <  highest_prio)) {
+            highest_prio = p_head->TCBPtr->Prio;
+        }
+        p_rwlock = p_rwlock->RWLockGrpNextPtr;
+    }
+    return (highest_prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          REMOVE A LOCK FROM A WRITER'S GROUP
+*
+* Description: This function is called when a writer gives up a lock.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+*              p_rwlock      is a pointer to the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockGrpRemove (OS_TCB     *p_tcb,
+                          OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK  **pp_rwlock;
+
+
+
+    pp_rwlock = &p_tcb->RWLockGrpHeadPtr;
+    while (*pp_rwlock != p_rwlock) {
+        pp_rwlock = &(*pp_rwlock)->RWLockGrpNextPtr;
+    }
+   *pp_rwlock                  = p_rwlock->RWLockGrpNextPtr;
+    p_rwlock->RWLockGrpNextPtr = (OS_RWLOCK *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        STOP WAITING ON A READER-WRITER LOCK
+*
+* Description: This function removes a task from the pend list of a lock without giving it the lock, because its
+*              timeout expired or because it is being deleted.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the task pending on the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with the scheduler locked or with interrupts disabled.
+*
+*              3) The writer owning the lock gives back the priority the task lent it.  If the task was the last
+*                 writer waiting on a lock only readers hold, the readers queued behind it are let in.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockPendRemove (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK  *p_rwlock;
+    OS_TCB     *p_tcb_owner;
+
+
+
+    p_rwlock = (OS_RWLOCK *)((void *)p_tcb->PendDataTblPtr->PendObjPtr);
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_WR) {
+        p_rwlock->WrWaitCtr--;
+    }
+    OS_PendListRemove(p_tcb);
+
+    p_tcb_owner = p_rwlock->OwnerTCBPtr;
+    if (p_tcb_owner != (OS_TCB *)0) {
+        OS_RWLockPrioRestore(p_tcb_owner);                  /* See Note #3                                            */
+    } else if ((p_rwlock->WrWaitCtr           == (OS_OBJ_QTY)0) &&
+               (p_rwlock->PendList.NbrEntries >  (OS_OBJ_QTY)0)) {
+        OS_RWLockGrant(p_rwlock, OS_TS_GET());
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                     FIND THE PRIORITY A WRITER MUST RUN AT
+*
+* Description: This function returns the base priority of a task, raised to the highest priority waiting on any lock
+*              or mutex it owns.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+* Returns    : The priority the task must run at.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_RWLockPrioFind (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio_high;
+
+
+
+#if OS_CFG_MUTEX_EN > 0u
+    prio_high = OS_MutexGrpPrioFindHighest(p_tcb);          /* Also covers the locks the task owns                    */
+#else
+    prio_high = OS_RWLockGrpPrioFindHighest(p_tcb);
+#endif
+    if (prio_high > p_tcb->BasePrio) {
+        prio_high = p_tcb->BasePrio;
+    }
+    return (prio_high);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         RESTORE THE PRIORITY OF A WRITER
+*
+* Description: This function lowers a writer back to its base priority, or to the highest priority still required by
+*              the locks and mutexes it owns.
+*
+* Arguments  : p_tcb         is a pointer to the TCB of the writer
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockPrioRestore (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio_new;
+
+
+
+    if (p_tcb->Prio == p_tcb->BasePrio) {                   /* Nothing was inherited                                  */
+        return;
+    }
+    prio_new = OS_RWLockPrioFind(p_tcb);
+    if (prio_new > p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio_new);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          FIND THE FIRST WAITING WRITER
+*
+* Description: This function returns the pend list entry of the highest priority writer waiting on a lock.
+*
+* Arguments  : p_rwlock      is a pointer to the lock
+*
+* Returns    : A pointer to the OS_PEND_DATA of the writer, or a NULL pointer if only readers are waiting.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The pend list is sorted by priority, so the first writer found is the highest priority one.
+*
+*              3) This walks the pend list.  Only OS_RWLockGrant() calls it, and only when .WrWaitCtr says a writer
+*                 is waiting; whether one is waiting at all is read from .WrWaitCtr.
+************************************************************************************************************************
+*/
+
+OS_PEND_DATA  *OS_RWLockWrWaitGet (OS_RWLOCK  *p_rwlock)
+{
+    OS_PEND_DATA  *p_pend_data;
+
+
+
+    p_pend_data = p_rwlock->PendList.HeadPtr;
+    while (p_pend_data != (OS_PEND_DATA *)0) {
+        if (p_pend_data->TCBPtr->PendOn == OS_TASK_PEND_ON_RWLOCK_WR) {
+            break;
+        }
+        p_pend_data = p_pend_data->NextPtr;
+    }
+    return (p_pend_data);
+}
+#endif
@@ -0,0 +1,497 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                         SCHEDULE TABLE (CYCLIC EXECUTIVE) MANAGEMENT
+*
+* File    : OS_SCHED_TBL.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A schedule table is a static array of entries, sorted by their offset in a cycle of 'period' ticks.  At
+*               each tick of the table, the entries whose offset is reached are activated:
+*
+*               (a) a task entry signals its task with OSTaskSemPost().  The task runs a loop that waits on
+*                   OSTaskSemPend() and does one job per activation.  The task must not use its task semaphore for
+*                   anything else.
+*
+*               (b) a function entry calls its function directly from the ISR that ticks the table.  The function
+*                   must be short and may only call services allowed from an ISR.
+*
+*           (2) Tables created with OS_OPT_SCHED_TBL_TICK are ticked by OSTimeTick().  Tables created with
+*               OS_OPT_SCHED_TBL_EXT are ticked by the application, calling OSSchedTblTick() from the ISR of its own
+*               timer (e.g. a CCU4 compare match), between OSIntEnter() and OSIntExit().  A table is only ever ticked
+*               from one ISR.
+*
+*           (3) Tasks activated by a table coexist with the other tasks and are scheduled by their priority.  Giving
+*               them the highest application priorities keeps the activation jitter to the ISR latency.  No delay
+*               list is involved.
+*
+*           (4) Budgets:
+*
+*               (a) A task entry has a budget in ticks, counted from its activation until its task waits on its
+*                   semaphore again.  Reaching the budget counts one overrun.  An activation that finds the task still
+*                   busy with the previous job is dropped & counted in .SkipCtr, so an overrunning task never builds
+*                   up a backlog.
+*
+*               (b) A function entry has a budget in timestamp (CPU_TS) units, checked against the duration of the
+*                   call.  This requires OS_CFG_TS_EN.
+*
+*               A budget of 0 disables the check for that entry.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_sched_tbl__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_SCHED_TBL_EN > 0u
+/*
+************************************************************************************************************************
+*                                                CREATE A SCHEDULE TABLE
+*
+* Description: This function creates a schedule table from an array of entries filled in by the application.
+*
+* Arguments  : p_tbl         is a pointer to the schedule table to create.
+*
+*              p_name        is a pointer to an ASCII string used to name the table.
+*
+*              p_entry_tbl   is a pointer to the array of entries.  Each entry must have its .Offset, .Budget and either
+*                            its .TCBPtr or its .FnctPtr (and .FnctArg) set.  Offsets must be in increasing order and
+*                            smaller than 'period'.  The array must remain allocated while the table is used.
+*
+*              nbr_entries   is the number of entries in 'p_entry_tbl'.
+*
+*              period        is the length of one cycle of the table, in table ticks.
+*
+*              opt           selects what ticks the table:
+*
+*                                OS_OPT_SCHED_TBL_TICK    OSTimeTick()
+*                                OS_OPT_SCHED_TBL_EXT     the application, through OSSchedTblTick()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                        if the call was successful
+*                                OS_ERR_CREATE_ISR                  if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME     if you are trying to create the table after you
+*                                                                   called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL                if 'p_tbl' or 'p_entry_tbl' is a NULL pointer
+*                                OS_ERR_OPT_INVALID                 if 'opt' is not one of the options above
+*                                OS_ERR_SCHED_TBL_ENTRY_INVALID     if an entry is not valid (see 'p_entry_tbl')
+*                                OS_ERR_SCHED_TBL_PERIOD_INVALID    if 'period' or 'nbr_entries' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) The table is created stopped.
+************************************************************************************************************************
+*/
+
+void  OSSchedTblCreate (OS_SCHED_TBL        *p_tbl,
+                        CPU_CHAR            *p_name,
+                        OS_SCHED_TBL_ENTRY  *p_entry_tbl,
+                        OS_OBJ_QTY           nbr_entries,
+                        OS_TICK              period,
+                        OS_OPT               opt,
+                        OS_ERR              *p_err)
+{
+    OS_SCHED_TBL_ENTRY  *p_entry;
+    OS_TICK              offset;
+    OS_OBJ_QTY           i;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_tbl == (OS_SCHED_TBL *)0) {                       /* Validate arguments                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_entry_tbl == (OS_SCHED_TBL_ENTRY *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_SCHED_TBL_TICK:
+        case OS_OPT_SCHED_TBL_EXT:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if ((period      == (OS_TICK   )0) ||
+        (nbr_entries == (OS_OBJ_QTY)0)) {
+       *p_err = OS_ERR_SCHED_TBL_PERIOD_INVALID;
+        return;
+    }
+
+    offset  = (OS_TICK)0;
+    p_entry = p_entry_tbl;
+    for (i = 0u; i < nbr_entries; i++) {                    /* Validate the entries & clear their counters            */
+        if ((p_entry->Offset <  offset) ||                  /* Offsets must be sorted & within the cycle              */
+            (p_entry->Offset >= period)) {
+           *p_err = OS_ERR_SCHED_TBL_ENTRY_INVALID;
+            return;
+        }
+        if ((p_entry->TCBPtr  == (OS_TCB          *)0) ==   /* Exactly one of a task or a function                    */
+            (p_entry->FnctPtr == (OS_SCHED_TBL_FNCT)0)) {
+           *p_err = OS_ERR_SCHED_TBL_ENTRY_INVALID;
+            return;
+        }
+        offset              = p_entry->Offset;
+        p_entry->Busy       = DEF_FALSE;
+        p_entry->Elapsed    = (OS_TICK)0;
+        p_entry->ActCtr     = (OS_CTR )0;
+        p_entry->OverrunCtr = (OS_CTR )0;
+        p_entry->SkipCtr    = (OS_CTR )0;
+        p_entry++;
+    }
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_tbl->Type       = OS_OBJ_TYPE_SCHED_TBL;              /* Mark the data structure as a schedule table            */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_tbl->NamePtr    = p_name;
+#else
+    (void)&p_name;
+#endif
+    p_tbl->EntryTbl   = p_entry_tbl;
+    p_tbl->NbrEntries = nbr_entries;
+    p_tbl->EntryIx    = (OS_OBJ_QTY)0;
+    p_tbl->Period     = period;
+    p_tbl->Time       = (OS_TICK   )0;
+    p_tbl->Opt        = opt;
+    p_tbl->State      = OS_SCHED_TBL_STATE_STOPPED;
+    p_tbl->NextPtr    = (OS_SCHED_TBL *)0;
+    p_tbl->CycleCtr   = (OS_CTR    )0;
+   *p_err             = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 START A SCHEDULE TABLE
+*
+* Description: This function starts a schedule table at the beginning of its cycle.  Entries at offset 0 are activated
+*              by the next tick of the table.
+*
+* Arguments  : p_tbl         is a pointer to the schedule table.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 if the call was successful
+*                                OS_ERR_OBJ_PTR_NULL         if 'p_tbl' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE             if 'p_tbl' is not a schedule table
+*                                OS_ERR_SCHED_TBL_ISR        if you called this function from an ISR
+*                                OS_ERR_SCHED_TBL_RUNNING    if the table is already running
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSchedTblStart (OS_SCHED_TBL  *p_tbl,
+                       OS_ERR        *p_err)
+{
+    OS_SCHED_TBL_ENTRY  *p_entry;
+    OS_OBJ_QTY           i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_SCHED_TBL_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_tbl == (OS_SCHED_TBL *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_tbl->Type != OS_OBJ_TYPE_SCHED_TBL) {             /* Make sure schedule table was created                   */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                   /* Check, reset & link in at once: no double start        */
+    if (p_tbl->State == OS_SCHED_TBL_STATE_RUNNING) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_TBL_RUNNING;
+        return;
+    }
+
+    p_entry = p_tbl->EntryTbl;
+    for (i = 0u; i < p_tbl->NbrEntries; i++) {
+        p_entry->Busy    = DEF_FALSE;
+        p_entry->Elapsed = (OS_TICK)0;
+        p_entry++;
+    }
+    p_tbl->EntryIx = (OS_OBJ_QTY)0;
+    p_tbl->Time    = (OS_TICK   )0;
+
+    if (p_tbl->Opt == OS_OPT_SCHED_TBL_TICK) {              /* Let OSTimeTick() tick the table                        */
+        p_tbl->NextPtr    = OSSchedTblListPtr;
+        OSSchedTblListPtr = p_tbl;
+    }
+    p_tbl->State = OS_SCHED_TBL_STATE_RUNNING;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 STOP A SCHEDULE TABLE
+*
+* Description: This function stops a schedule table.  Jobs already activated complete normally.
+*
+* Arguments  : p_tbl         is a pointer to the schedule table.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 if the call was successful
+*                                OS_ERR_OBJ_PTR_NULL         if 'p_tbl' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE             if 'p_tbl' is not a schedule table
+*                                OS_ERR_SCHED_TBL_ISR        if you called this function from an ISR
+*                                OS_ERR_SCHED_TBL_STOPPED    if the table is not running
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSchedTblStop (OS_SCHED_TBL  *p_tbl,
+                      OS_ERR        *p_err)
+{
+    OS_SCHED_TBL  **pp_tbl;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_SCHED_TBL_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_tbl == (OS_SCHED_TBL *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_tbl->Type != OS_OBJ_TYPE_SCHED_TBL) {             /* Make sure schedule table was created                   */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tbl->State != OS_SCHED_TBL_STATE_RUNNING) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_TBL_STOPPED;
+        return;
+    }
+    if (p_tbl->Opt == OS_OPT_SCHED_TBL_TICK) {              /* Unlink the table from the tables ticked by the kernel  */
+        pp_tbl = &OSSchedTblListPtr;
+        while (*pp_tbl != p_tbl) {
+            pp_tbl = &(*pp_tbl)->NextPtr;
+        }
+       *pp_tbl         = p_tbl->NextPtr;
+        p_tbl->NextPtr = (OS_SCHED_TBL *)0;
+    }
+    p_tbl->State = OS_SCHED_TBL_STATE_STOPPED;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 TICK A SCHEDULE TABLE
+*
+* Description: This function advances a running schedule table by one tick: it checks the budget of the busy task
+*              entries, then activates the entries whose offset is reached.
+*
+* Arguments  : p_tbl         is a pointer to the schedule table.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called from an ISR, only for tables created with OS_OPT_SCHED_TBL_EXT & from a
+*                 single ISR per table (see Note #2 at the top of this file).  OSTimeTick() ticks the other tables.
+*
+*              2) A task entry is no longer busy once its task waits on its task semaphore again with no signal
+*                 left to consume.
+************************************************************************************************************************
+*/
+
+void  OSSchedTblTick (OS_SCHED_TBL  *p_tbl)
+{
+    OS_SCHED_TBL_ENTRY  *p_entry;
+    OS_TCB              *p_tcb;
+    OS_OBJ_QTY           i;
+    OS_ERR               err;
+#if OS_CFG_TS_EN > 0u
+    CPU_TS               ts;
+#endif
+
+
+    if (p_tbl->State != OS_SCHED_TBL_STATE_RUNNING) {
+        return;
+    }
+                                                            /* ------------- CHECK BUSY TASK BUDGETS ---------------- */
+    p_entry = p_tbl->EntryTbl;
+    for (i = 0u; i < p_tbl->NbrEntries; i++) {
+        if (p_entry->Busy == DEF_TRUE) {
+            p_tcb = p_entry->TCBPtr;
+            if ((p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) &&  /* Job done? (see Note #2)                           */
+                (p_tcb->SemCtr == (OS_SEM_CTR)0) &&
+                ((p_tcb->TaskState == OS_TASK_STATE_PEND) ||
+                 (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT))) {
+                p_entry->Busy = DEF_FALSE;
+            } else {
+                p_entry->Elapsed++;
+                if (p_entry->Elapsed == p_entry->Budget) {      /* Count each overrun once                           */
+                    p_entry->OverrunCtr++;
+                }
+            }
+        }
+        p_entry++;
+    }
+                                                            /* ------------ ACTIVATE THE ENTRIES DUE NOW ------------ */
+    p_entry = &p_tbl->EntryTbl[p_tbl->EntryIx];
+    while ((p_tbl->EntryIx  < p_tbl->NbrEntries) &&
+           (p_entry->Offset == p_tbl->Time)) {
+        if (p_entry->TCBPtr != (OS_TCB *)0) {
+            if (p_entry->Busy == DEF_TRUE) {                /* Previous job still running: drop this activation       */
+                p_entry->SkipCtr++;
+            } else {
+                p_entry->Busy    = DEF_TRUE;
+                p_entry->Elapsed = (OS_TICK)0;
+                p_entry->ActCtr++;
+                (void)OSTaskSemPost(p_entry->TCBPtr,
+                                    OS_OPT_POST_NONE,
+                                   &err);
+            }
+        } else {
+            p_entry->ActCtr++;
+#if OS_CFG_TS_EN > 0u
+            ts = OS_TS_GET();
+#endif
+            (*p_entry->FnctPtr)(p_entry->FnctArg);
+#if OS_CFG_TS_EN > 0u
+            ts = OS_TS_GET() - ts;
+            if ((p_entry->Budget > (CPU_TS)0) &&
+                (ts              > (CPU_TS)p_entry->Budget)) {
+                p_entry->OverrunCtr++;
+            }
+#endif
+        }
+        p_tbl->EntryIx++;
+        p_entry++;
+    }
+
+    p_tbl->Time++;
+    if (p_tbl->Time >= p_tbl->Period) {                     /* End of the cycle                                       */
+        p_tbl->Time    = (OS_TICK   )0;
+        p_tbl->EntryIx = (OS_OBJ_QTY)0;
+        p_tbl->CycleCtr++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           TICK THE TABLES DRIVEN BY THE KERNEL
+*
+* Description: This function is called by OSTimeTick() to tick every running table created with OS_OPT_SCHED_TBL_TICK.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_SchedTblUpdate (void)
+{
+    OS_SCHED_TBL  *p_tbl;
+
+
+    p_tbl = OSSchedTblListPtr;
+    while (p_tbl != (OS_SCHED_TBL *)0) {
+        OSSchedTblTick(p_tbl);
+        p_tbl = p_tbl->NextPtr;
+    }
+}
+#endif
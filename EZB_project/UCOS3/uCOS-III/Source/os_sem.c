@@ -115,6 +115,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
 #endif
     p_sem->Ctr     = cnt;                                   /* Set semaphore value                                    */
     p_sem->TS      = (CPU_TS)0;
+#if OS_CFG_WAIT_SET_EN > 0u
+    p_sem->WaitSetEntryPtr = (OS_WAIT_SET_ENTRY *)0;        /* Not registered in a wait set                           */
+#endif
 #if OS_CFG_DBG_EN > 0u
     p_sem->NamePtr = p_name;                                /* Save the name of the semaphore                         */
 #else
@@ -387,6 +390,19 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     }
 #endif
 
+#if OS_CFG_SEM_FAST_EN > 0u
+    if (OS_SemPendFast(p_sem, &ctr) == DEF_TRUE) {          /* Uncontended: take a unit without masking interrupts    */
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts  = p_sem->TS;                              /*      get timestamp of last post                        */
+        }
+       *p_err = OS_ERR_NONE;
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+        TRACE_OS_SEM_PEND(p_sem);                           /* Record the event.                                      */
+#endif
+        return (ctr);
+    }
+#endif
+
     if (p_ts != (CPU_TS *)0) {
        *p_ts  = (CPU_TS)0;                                  /* Initialize the returned timestamp                      */
     }
@@ -709,6 +725,14 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     TRACE_OS_SEM_POST(p_sem);                               /* Record the event.                                      */
 #endif
 
+#if OS_CFG_SEM_FAST_EN > 0u
+    p_sem->TS = ts;                                         /* Save timestamp before a fast pend can take the unit    */
+    if (OS_SemPostFast(p_sem, &ctr) == DEF_TRUE) {          /* Nobody to ready: skip the critical section             */
+       *p_err = OS_ERR_NONE;
+        return (ctr);
+    }
+#endif
+
     ctr = OS_SemPost(p_sem,                                 /* Post to semaphore                                      */
                      opt,
                      ts,
@@ -793,6 +817,16 @@ void  OSSemSet (OS_SEM      *p_sem,
            *p_err      = OS_ERR_TASK_WAITING;
         }
     }
+#if OS_CFG_WAIT_SET_EN > 0u
+    if ((p_sem->WaitSetEntryPtr != (OS_WAIT_SET_ENTRY *)0) &&
+        (p_sem->Ctr             >  (OS_SEM_CTR)0)) {        /* Notify the wait set the semaphore is registered in     */
+        OS_CRITICAL_ENTER_CPU_EXIT();
+        OS_WaitSetSignal(p_sem->WaitSetEntryPtr);
+        OS_CRITICAL_EXIT_NO_SCHED();
+        OSSched();
+        return;
+    }
+#endif
     CPU_CRITICAL_EXIT();
 }
 #endif
@@ -821,6 +855,11 @@ void  OS_SemClr (OS_SEM  *p_sem)
 #endif
     p_sem->Ctr     = (OS_SEM_CTR)0;                         /* Set semaphore value                                    */
     p_sem->TS      = (CPU_TS    )0;                         /* Clear the time stamp                                   */
+#if OS_CFG_WAIT_SET_EN > 0u
+    if (p_sem->WaitSetEntryPtr != (OS_WAIT_SET_ENTRY *)0) { /* Leave the wait set                                     */
+        OS_WaitSetEntryRemove(p_sem->WaitSetEntryPtr);
+    }
+#endif
 #if OS_CFG_DBG_EN > 0u
     p_sem->NamePtr = (CPU_CHAR *)((void *)"?SEM");
 #endif
@@ -924,6 +963,54 @@ void  OS_SemInit (OS_ERR  *p_err)
 }
 
 
+/*
+************************************************************************************************************************
+*                                        TAKE A SEMAPHORE UNIT WITHOUT LOCKING
+*
+* Description: This function decrements the semaphore count with an exclusive load/store sequence, without masking
+*              interrupts or locking the scheduler.
+*
+* Argument(s): p_sem      is a pointer to the semaphore
+*              -----
+*
+*              p_ctr      is a pointer to a variable that will receive the new count on success
+*              -----
+*
+* Returns    : DEF_TRUE   if a unit was taken
+*              DEF_FALSE  if the count is 0; the caller must use the regular (blocking) path
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The sequence only succeeds if nothing ran between the load and the store (see OS_CPU_LDREX()), so
+*                 it cannot race with the code that updates the count inside critical sections.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_SEM_FAST_EN > 0u
+CPU_BOOLEAN  OS_SemPendFast (OS_SEM      *p_sem,
+                             OS_SEM_CTR  *p_ctr)
+{
+    CPU_INT32U  ctr;
+    CPU_INT32U  res;
+
+
+
+    do {
+        OS_CPU_LDREX(&p_sem->Ctr, ctr);
+        if (ctr == (CPU_INT32U)0) {                         /* Nothing available, the caller may have to block        */
+            OS_CPU_CLREX();
+            return (DEF_FALSE);
+        }
+        ctr--;
+        OS_CPU_STREX(&p_sem->Ctr, ctr, res);
+    } while (res != (CPU_INT32U)0);                         /* Interrupted, try again                                 */
+
+   *p_ctr = (OS_SEM_CTR)ctr;
+    return (DEF_TRUE);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 POST TO A SEMAPHORE
@@ -1005,6 +1092,18 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
         p_sem->Ctr++;                                       /* No                                                     */
         ctr       = p_sem->Ctr;
         p_sem->TS = ts;                                     /* Save timestamp in semaphore control block              */
+#if OS_CFG_WAIT_SET_EN > 0u
+        if (p_sem->WaitSetEntryPtr != (OS_WAIT_SET_ENTRY *)0) {
+            OS_CRITICAL_ENTER_CPU_EXIT();
+            OS_WaitSetSignal(p_sem->WaitSetEntryPtr);       /* Notify the wait set the semaphore is registered in     */
+            OS_CRITICAL_EXIT_NO_SCHED();
+            if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+                OSSched();                                  /* Run the scheduler                                      */
+            }
+           *p_err = OS_ERR_NONE;
+            return (ctr);
+        }
+#endif
         CPU_CRITICAL_EXIT();
        *p_err     = OS_ERR_NONE;
         return (ctr);
@@ -1037,4 +1136,59 @@ OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
     return (ctr);
 }
 
+
+/*
+************************************************************************************************************************
+*                                        RETURN A SEMAPHORE UNIT WITHOUT LOCKING
+*
+* Description: This function increments the semaphore count with an exclusive load/store sequence, without masking
+*              interrupts or locking the scheduler.  It only does so if no task is waiting on the semaphore and no wait
+*              set needs to be told, i.e. when OS_SemPost() would do nothing more than increment the count.
+*
+* Argument(s): p_sem      is a pointer to the semaphore
+*              -----
+*
+*              p_ctr      is a pointer to a variable that will receive the new count on success
+*              -----
+*
+* Returns    : DEF_TRUE   if the unit was returned
+*              DEF_FALSE  if a task must be readied or the count would overflow; the caller must use OS_SemPost()
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The pend list and wait set are checked between the exclusive load and store.  A task that starts
+*                 waiting in that window can only do so after an exception, which makes the store fail and the check
+*                 run again.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_SEM_FAST_EN > 0u
+CPU_BOOLEAN  OS_SemPostFast (OS_SEM      *p_sem,
+                             OS_SEM_CTR  *p_ctr)
+{
+    CPU_INT32U  ctr;
+    CPU_INT32U  res;
+
+
+
+    do {
+        OS_CPU_LDREX(&p_sem->Ctr, ctr);
+                                                            /* Somebody to ready, or about to overflow?               */
+        if ((p_sem->PendList.NbrEntries != (OS_OBJ_QTY)0) ||
+#if OS_CFG_WAIT_SET_EN > 0u
+            (p_sem->WaitSetEntryPtr     != (OS_WAIT_SET_ENTRY *)0) ||
+#endif
+            (ctr                        == DEF_INT_32U_MAX_VAL)) {
+            OS_CPU_CLREX();
+            return (DEF_FALSE);
+        }
+        ctr++;
+        OS_CPU_STREX(&p_sem->Ctr, ctr, res);
+    } while (res != (CPU_INT32U)0);                         /* Interrupted, try again                                 */
+
+   *p_ctr = (OS_SEM_CTR)ctr;
+    return (DEF_TRUE);
+}
+#endif
+
 #endif
@@ -0,0 +1,294 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                   SEQUENCE LOCKS
+*
+* File    : OS_SEQLOCK.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A sequence lock protects a multi-word record that has ONE writer (a task or an ISR) and any number of
+*               readers.  The writer makes the sequence counter odd while it updates the record and even again when
+*               done; a reader copies the record and retries if the counter was odd or changed meanwhile.
+*
+*           (2) Neither side disables interrupts or blocks: the writer never waits, and readers never delay the writer.
+*
+*           (3) A reader that preempted the writer in the middle of an update cannot get a consistent copy until the
+*               writer runs again, so readers must not spin forever.  OSSeqLockRead() gives up after
+*               OS_CFG_SEQLOCK_RD_RETRY_MAX attempts; callers of OSSeqLockRdBegin()/OSSeqLockRdRetry() must bound their
+*               loop the same way.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_seqlock__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_SEQLOCK_EN > 0u
+/*
+************************************************************************************************************************
+*                                                CREATE A SEQUENCE LOCK
+*
+* Description: This function initializes a sequence lock.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock to initialize.
+*
+*              p_name        is a pointer to an ASCII string used to name the lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to create the lock after you
+*                                                                  called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_lock' is a NULL pointer
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSeqLockCreate (OS_SEQLOCK  *p_lock,
+                       CPU_CHAR    *p_name,
+                       OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_lock == (OS_SEQLOCK *)0) {                        /* Validate 'p_lock'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_lock->Type    = OS_OBJ_TYPE_SEQLOCK;                  /* Mark the data structure as a sequence lock             */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_lock->NamePtr = p_name;
+#else
+    (void)&p_name;
+#endif
+    p_lock->Seq     = (OS_SEQ_CTR)0;
+   *p_err           = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           START READING A PROTECTED RECORD
+*
+* Description: This function is called by a reader before it copies the record.  The value returned is passed to
+*              OSSeqLockRdRetry() once the copy is done.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+* Returns    : The sequence counter of the lock.
+*
+* Note(s)    : 1) The arguments are not checked, as this function is meant for tight read loops.
+************************************************************************************************************************
+*/
+
+OS_SEQ_CTR  OSSeqLockRdBegin (OS_SEQLOCK  *p_lock)
+{
+    OS_SEQ_CTR  seq;
+
+
+    seq = p_lock->Seq;
+    CPU_RMB();                                              /* Read the record only after the counter                 */
+    return (seq);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CHECK A COPY OF A PROTECTED RECORD
+*
+* Description: This function is called by a reader after it copied the record, to find out whether the copy is
+*              consistent.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              seq           is the value returned by OSSeqLockRdBegin() before the copy.
+*
+* Returns    : DEF_FALSE     if the copy is consistent.
+*              DEF_TRUE      if the record was being written during the copy and the copy must be retried (see Note #3
+*                            at the top of this file).
+*
+* Note(s)    : 1) The arguments are not checked, as this function is meant for tight read loops.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSSeqLockRdRetry (OS_SEQLOCK  *p_lock,
+                               OS_SEQ_CTR   seq)
+{
+    CPU_RMB();                                              /* Finish reading the record before the counter           */
+    if ((seq & (OS_SEQ_CTR)1) != (OS_SEQ_CTR)0) {           /* A write was in progress at the start                   */
+        return (DEF_TRUE);
+    }
+    if (p_lock->Seq != seq) {                               /* A write happened during the copy                       */
+        return (DEF_TRUE);
+    }
+    return (DEF_FALSE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               TAKE A SNAPSHOT OF A RECORD
+*
+* Description: This function copies a record protected by a sequence lock, retrying while the writer updates it.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              p_dst         is a pointer to where the snapshot is copied.
+*
+*              p_src         is a pointer to the protected record.
+*
+*              size          is the size of the record (in bytes).
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              if '*p_dst' holds a consistent snapshot
+*                                OS_ERR_OBJ_PTR_NULL      if 'p_lock', 'p_dst' or 'p_src' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          if 'p_lock' is not a sequence lock
+*                                OS_ERR_SEQLOCK_RETRY     if the record was still being written after
+*                                                         OS_CFG_SEQLOCK_RD_RETRY_MAX attempts (see Note #3 at the top
+*                                                         of this file), '*p_dst' is not consistent
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSSeqLockRead (OS_SEQLOCK  *p_lock,
+                     void        *p_dst,
+                     void        *p_src,
+                     CPU_SIZE_T   size,
+                     OS_ERR      *p_err)
+{
+    CPU_INT08U  *p_dst_08;
+    CPU_INT08U  *p_src_08;
+    CPU_SIZE_T   i;
+    OS_SEQ_CTR   seq;
+    OS_QTY       try_ctr;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_lock == (OS_SEQLOCK *)0) ||                      /* Validate arguments                                     */
+        (p_dst  == (void       *)0) ||
+        (p_src  == (void       *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {              /* Make sure lock was created                             */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    for (try_ctr = 0u; try_ctr < OS_CFG_SEQLOCK_RD_RETRY_MAX; try_ctr++) {
+        seq      = OSSeqLockRdBegin(p_lock);
+        p_dst_08 = (CPU_INT08U *)p_dst;
+        p_src_08 = (CPU_INT08U *)p_src;
+        for (i = 0u; i < size; i++) {
+           *p_dst_08++ = *p_src_08++;
+        }
+        if (OSSeqLockRdRetry(p_lock, seq) == DEF_FALSE) {
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+    }
+   *p_err = OS_ERR_SEQLOCK_RETRY;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           START WRITING A PROTECTED RECORD
+*
+* Description: This function is called by the writer before it updates the record.  It never waits.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Only one writer is allowed per lock; it may be a task or an ISR.
+*
+*              2) The arguments are not checked, as this function is meant for frequent updates.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockWrBegin (OS_SEQLOCK  *p_lock)
+{
+    p_lock->Seq++;                                          /* Odd: a write is in progress                            */
+    CPU_WMB();                                              /* Publish the counter before any part of the record      */
+}
+
+
+/*
+************************************************************************************************************************
+*                                          FINISH WRITING A PROTECTED RECORD
+*
+* Description: This function is called by the writer once the record is updated.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The arguments are not checked, as this function is meant for frequent updates.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockWrEnd (OS_SEQLOCK  *p_lock)
+{
+    CPU_WMB();                                              /* Publish the whole record before the counter            */
+    p_lock->Seq++;                                          /* Even: the record is consistent                         */
+}
+#endif
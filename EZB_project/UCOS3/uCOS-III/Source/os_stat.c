@@ -53,6 +53,10 @@ const  CPU_CHAR  *os_stat__c = "$Id: $";
 *                             OS_ERR_NONE
 *
 * Returns    : none
+*
+* Note(s)    : 1) OSStatTaskCPUUsageMax is guarded by OSStatSeqLock, whose only writer must be the statistic task.  It
+*                 is therefore not cleared here: OSStatTaskCPUUsageMaxRst asks the statistic task to clear it within its
+*                 next write section.
 ************************************************************************************************************************
 */
 
@@ -85,7 +89,11 @@ void  OSStatReset (OS_ERR  *p_err)
 #endif
 
 #if OS_CFG_STAT_TASK_EN > 0u
+#if OS_CFG_SEQLOCK_EN > 0u
+    OSStatTaskCPUUsageMaxRst = DEF_TRUE;                    /* See Note #1                                            */
+#else
     OSStatTaskCPUUsageMax = 0u;
+#endif
     OSStatTaskTimeMax     = (CPU_TS)0;
 #endif
 
@@ -103,6 +111,10 @@ void  OSStatReset (OS_ERR  *p_err)
     OSSchedLockTimeMax    = (CPU_TS)0;                      /* Reset the maximum scheduler lock time                  */
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    OSSchedEDFMissCtr     = (OS_CTR)0;                      /* Reset the number of missed EDF deadlines               */
+#endif
+
 #if ((OS_MSG_EN > 0u) && (OS_CFG_DBG_EN > 0u))
     OSMsgPool.NbrUsedMax  = 0u;
 #endif
@@ -140,6 +152,10 @@ void  OSStatReset (OS_ERR  *p_err)
         p_msg_q                 = &p_tcb->MsgQ;
         p_msg_q->NbrEntriesMax  = (OS_MSG_QTY  )0;
 #endif
+
+#if OS_CFG_SCHED_EDF_EN > 0u
+        p_tcb->EDFMissCtr       = (OS_CTR      )0;
+#endif
         p_tcb                   = p_tcb->DbgNextPtr;
         CPU_CRITICAL_EXIT();
     }
@@ -325,9 +341,18 @@ void  OS_StatTask (void  *p_arg)
         OSIntDisTimeMax = CPU_IntDisMeasMaxGet();
 #endif
 
+#if OS_CFG_SEQLOCK_EN > 0u
+        OSSeqLockWrBegin(&OSStatSeqLock);                   /* Readers see the CPU usage values updated together      */
+#endif
         CPU_CRITICAL_ENTER();                               /* ----------------- OVERALL CPU USAGE ------------------ */
         OSStatTaskCtrRun   = OSStatTaskCtr;                 /* Obtain the of the stat counter for the past .1 second  */
         OSStatTaskCtr      = (OS_TICK)0;                    /* Reset the stat counter for the next .1 second          */
+#if OS_CFG_SEQLOCK_EN > 0u
+        if (OSStatTaskCPUUsageMaxRst == DEF_TRUE) {         /* Reset the peak as requested by OSStatReset()           */
+            OSStatTaskCPUUsageMaxRst = DEF_FALSE;
+            OSStatTaskCPUUsageMax    = 0u;
+        }
+#endif
         CPU_CRITICAL_EXIT();
 
         if (OSStatTaskCtrMax > OSStatTaskCtrRun) {          /* Compute CPU Usage with best resolution                 */
@@ -355,6 +380,9 @@ void  OS_StatTask (void  *p_arg)
         } else {
             OSStatTaskCPUUsage = (OS_CPU_USAGE)10000u;
         }
+#if OS_CFG_SEQLOCK_EN > 0u
+        OSSeqLockWrEnd(&OSStatSeqLock);
+#endif
 
         OSStatTaskHook();                                   /* Invoke user definable hook                             */
 
@@ -428,6 +456,12 @@ void  OS_StatTask (void  *p_arg)
                          &err);
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+            CPU_CRITICAL_ENTER();
+            OS_EDFMissChk(p_tcb);                           /* Count EDF jobs still running past their deadline       */
+            CPU_CRITICAL_EXIT();
+#endif
+
             CPU_CRITICAL_ENTER();
             p_tcb = p_tcb->DbgNextPtr;
             CPU_CRITICAL_EXIT();
@@ -485,6 +519,15 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
     OSStatTaskCtrMax = (OS_TICK)0;
     OSStatTaskRdy    = OS_STATE_NOT_RDY;                    /* Statistic task is not ready                            */
     OSStatResetFlag  = DEF_FALSE;
+#if OS_CFG_SEQLOCK_EN > 0u
+    OSStatTaskCPUUsageMaxRst = DEF_FALSE;
+    OSSeqLockCreate(&OSStatSeqLock,                         /* Guards the CPU usage values (see OS_StatTask())        */
+                    (CPU_CHAR *)"uC/OS-III Stat Lock",
+                    p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
 
                                                             /* ---------------- CREATE THE STAT TASK ---------------- */
     if (OSCfg_StatTaskStkBasePtr == (CPU_STK *)0) {
@@ -67,7 +67,7 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
                         OS_PRIO   prio_new,
                         OS_ERR   *p_err)
 {
-#if OS_CFG_MUTEX_EN > 0u
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_RWLOCK_EN == 0u)
     OS_PRIO  prio_high;
 #endif
     CPU_SR_ALLOC();
@@ -113,9 +113,15 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 
     OS_CRITICAL_ENTER();
 
-#if OS_CFG_MUTEX_EN > 0u
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_RWLOCK_EN > 0u)
     p_tcb->BasePrio = prio_new;                             /* Update base priority                                   */
+#endif
 
+#if OS_CFG_RWLOCK_EN > 0u
+    if (prio_new > p_tcb->Prio) {                           /* Keep what waiters on owned locks and mutexes lent us   */
+        prio_new = OS_RWLockPrioFind(p_tcb);
+    }
+#elif OS_CFG_MUTEX_EN > 0u
     if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Owning a mutex?                                      */
         if (prio_new > p_tcb->Prio) {
             prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
@@ -192,7 +198,10 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *
 *                                 OS_OPT_TASK_NONE            No option selected
 *                                 OS_OPT_TASK_STK_CHK         Stack checking to be allowed for the task
-*                                 OS_OPT_TASK_STK_CLR         Clear the stack when the task is created
+*                                 OS_OPT_TASK_STK_CLR         Fill the stack with OS_TASK_STK_FILL when the task is
+*                                                             created, so that OSTaskStkChk() sees all of its stack
+*                                                             usage.  Without it, the first OSTaskStkChk() fills
+*                                                             the stack instead (see OSTaskStkChk() Note #3).
 *                                 OS_OPT_TASK_SAVE_FP         If the CPU has floating-point registers, save them
 *                                                             during a context switch.
 *                                 OS_OPT_TASK_NO_TLS          If the caller doesn't want or need TLS (Thread Local 
@@ -355,7 +364,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
         if ((opt & OS_OPT_TASK_STK_CLR) != (OS_OPT)0) {     /* See if stack needs to be cleared                       */
             p_sp = p_stk_base;
             for (i = 0u; i < stk_size; i++) {               /* Stack grows from HIGH to LOW memory                    */
-               *p_sp = (CPU_STK)0;                          /* Clear from bottom of stack and up!                     */
+               *p_sp = OS_TASK_STK_FILL;                    /* Fill from bottom of stack and up!                      */
                 p_sp++;
             }
         }
@@ -388,7 +397,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 
     p_tcb->Prio          = prio;                            /* Save the task's priority                               */
 
-#if OS_CFG_MUTEX_EN > 0u
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_RWLOCK_EN > 0u)
     p_tcb->BasePrio      = prio;                            /* Set the base priority                                  */
 #endif
 
@@ -412,6 +421,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
     p_tcb->StkBasePtr    = p_stk_base;                      /* Save pointer to the base address of the stack          */
     p_tcb->StkSize       = stk_size;                        /* Save the stack size (in number of CPU_STK elements)    */
+#endif
+#if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
+    p_tcb->StkHighWaterPtr = p_sp;                          /* The initial stack frame is the first high-water mark   */
 #endif
     p_tcb->Opt           = opt;                             /* Save task options                                      */
 
@@ -564,9 +576,17 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  case OS_TASK_PEND_ON_MULTI:
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_WAIT_SET:
                       OS_PendListRemove(p_tcb);
                       break;
 
+#if OS_CFG_RWLOCK_EN > 0u
+                 case OS_TASK_PEND_ON_RWLOCK_RD:
+                 case OS_TASK_PEND_ON_RWLOCK_WR:
+                      OS_RWLockPendRemove(p_tcb);           /* Also lowers the writer we lent our priority to         */
+                      break;
+#endif
+
 #if OS_CFG_MUTEX_EN > 0u
                  case OS_TASK_PEND_ON_MUTEX:
                       p_tcb_owner = ((OS_MUTEX *)p_tcb->PendDataTblPtr->PendObjPtr)->OwnerTCBPtr;
@@ -610,10 +630,20 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if OS_CFG_RWLOCK_EN > 0u
+    if (p_tcb->RWLockGrpHeadPtr != (OS_RWLOCK *)0) {        /* Release the locks the task owns for writing            */
+        OS_RWLockGrpPostAll(p_tcb);
+    }
+#endif
+
 #if OS_CFG_TASK_Q_EN > 0u
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Free task's message queue messages                     */
 #endif
 
+#if OS_CFG_SCHED_EDF_EN > 0u
+    OS_EDFRemove(p_tcb);                                    /* Give back the task's EDF utilization                   */
+#endif
+
     OSTaskDelHook(p_tcb);                                   /* Call user defined hook                                 */
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
@@ -1771,6 +1801,24 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 *                              OS_ERR_TASK_OPT           if you did NOT specified OS_OPT_TASK_STK_CHK when the task
 *                                                        was created
 *                              OS_ERR_TASK_STK_CHK_ISR   you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The task's high-water mark (p_tcb->StkHighWaterPtr) starts at the initial stack frame & only moves
+*                 deeper.  Each call first reads the OS_TASK_STK_CHK_WIN entries just past the mark: while they all
+*                 still hold OS_TASK_STK_FILL the mark stands, so a call costs a few reads whatever the stack size.
+*                 Only when one of them was written is the stack rescanned from its end up to the first entry that
+*                 no longer holds OS_TASK_STK_FILL, which becomes the new mark.  A frame that reaches past the window
+*                 without writing to it (e.g. a large uninitialized local array) is found by the first later call
+*                 that sees the window touched.
+*
+*              2) Entries are counted as used when they no longer hold OS_TASK_STK_FILL.  A task created with
+*                 OS_OPT_TASK_STK_CLR has its whole stack filled at creation, so all of its usage is seen.
+*
+*              3) A task created without OS_OPT_TASK_STK_CLR has its stack filled by the first call made from another
+*                 task: the entries below its saved stack pointer are free at that time, and the scheduler is locked
+*                 while they are filled so that the task cannot use them meanwhile.  Its usage is measured from then
+*                 on.  Until then, the usage reported is that of its initial stack frame.
 ************************************************************************************************************************
 */
 
@@ -1782,6 +1830,12 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
 {
     CPU_STK_SIZE  free_stk;
     CPU_STK      *p_stk;
+    CPU_STK      *p_stk_end;
+    CPU_STK      *p_stk_mark;
+    CPU_STK      *p_stk_sp;
+    CPU_STK_SIZE  win;
+    CPU_BOOLEAN   stk_fill;
+    OS_ERR        err;
     CPU_SR_ALLOC();
 
 
@@ -1832,22 +1886,113 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
        *p_err  =  OS_ERR_TASK_OPT;
         return;
     }
+    p_stk_mark = p_tcb->StkHighWaterPtr;                    /* Resume from the last known high-water mark             */
+    stk_fill   = DEF_NO;
+    if (((p_tcb->Opt & OS_OPT_TASK_STK_CLR) == (OS_OPT)0) &&/* Stack not filled yet & task not running?               */
+         (p_tcb != OSTCBCurPtr)) {
+        stk_fill = DEF_YES;
+    }
     CPU_CRITICAL_EXIT();
 
-    free_stk  = 0u;
 #if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
-    p_stk = p_tcb->StkBasePtr;                              /* Start at the lowest memory and go up                   */
-    while (*p_stk == (CPU_STK)0) {                          /* Compute the number of zero entries on the stk          */
-        p_stk++;
-        free_stk++;
-    }
+#ifdef  OS_CPU_STK_GUARD_END
+    p_stk_end = OS_CPU_STK_GUARD_END(p_tcb->StkBasePtr);    /* Skip the port's stack guard, it is not usable stack    */
+#else
+    p_stk_end = p_tcb->StkBasePtr;                          /* Start at the lowest memory                             */
+#endif
+#else
+    p_stk_end = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;    /* Start at the highest memory                            */
+#endif
+
+    if (stk_fill == DEF_YES) {                              /* Fill the free stack once (see Note #3)                 */
+        OSSchedLock(&err);                                  /* Keep the task off its stack while it is filled         */
+        if (err == OS_ERR_NONE) {
+            CPU_CRITICAL_ENTER();
+            p_stk_sp = p_tcb->StkPtr;                       /* The task may have been deleted meanwhile               */
+            if ((p_stk_sp == (CPU_STK *)0) ||
+                ((p_tcb->Opt & OS_OPT_TASK_STK_CLR) != (OS_OPT)0)) {
+                stk_fill = DEF_NO;
+            }
+            CPU_CRITICAL_EXIT();
+
+            if (stk_fill == DEF_YES) {
+                p_stk = p_stk_sp;
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+                while (p_stk > p_stk_end) {                 /* Fill below the saved stack pointer                     */
+                    p_stk--;
+                   *p_stk = OS_TASK_STK_FILL;
+                }
+#else
+                while (p_stk < p_stk_end) {                 /* Fill above the saved stack pointer                     */
+                    p_stk++;
+                   *p_stk = OS_TASK_STK_FILL;
+                }
+#endif
+                CPU_CRITICAL_ENTER();
+                p_stk_mark = p_tcb->StkHighWaterPtr;
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+                if (p_stk_sp < p_stk_mark) {                /* Keep the deeper of the mark & the saved stack pointer  */
+                    p_stk_mark = p_stk_sp;
+                }
 #else
-    p_stk = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;        /* Start at the highest memory and go down                */
-    while (*p_stk == (CPU_STK)0) {
-        free_stk++;
+                if (p_stk_sp > p_stk_mark) {
+                    p_stk_mark = p_stk_sp;
+                }
+#endif
+                p_tcb->StkHighWaterPtr = p_stk_mark;
+                p_tcb->Opt |= OS_OPT_TASK_STK_CLR;          /* The stack now holds the fill pattern                   */
+                CPU_CRITICAL_EXIT();
+            }
+            OSSchedUnlock(&err);
+        }
+    }
+
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+    p_stk = p_stk_mark;                                     /* Check the window past the mark first (see Note #1)     */
+    win   = OS_TASK_STK_CHK_WIN;
+    while ((p_stk > p_stk_end) &&
+           (win   > (CPU_STK_SIZE)0) &&
+           (*(p_stk - 1u) == OS_TASK_STK_FILL)) {
         p_stk--;
+        win--;
+    }
+    if ((p_stk > p_stk_end) &&                              /* Window touched: rescan up to the first used entry      */
+        (win   > (CPU_STK_SIZE)0)) {
+        p_stk = p_stk_end;
+        while ((p_stk < p_stk_mark) &&
+               (*p_stk == OS_TASK_STK_FILL)) {
+            p_stk++;
+        }
+        p_stk_mark = p_stk;
+    }
+    free_stk = (CPU_STK_SIZE)(p_stk_mark - p_stk_end);
+#else
+    p_stk = p_stk_mark;
+    win   = OS_TASK_STK_CHK_WIN;
+    while ((p_stk < p_stk_end) &&
+           (win   > (CPU_STK_SIZE)0) &&
+           (*(p_stk + 1u) == OS_TASK_STK_FILL)) {
+        p_stk++;
+        win--;
+    }
+    if ((p_stk < p_stk_end) &&
+        (win   > (CPU_STK_SIZE)0)) {
+        p_stk = p_stk_end;
+        while ((p_stk > p_stk_mark) &&
+               (*p_stk == OS_TASK_STK_FILL)) {
+            p_stk--;
+        }
+        p_stk_mark = p_stk;
     }
+    free_stk = (CPU_STK_SIZE)(p_stk_end - p_stk_mark);
 #endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->StkHighWaterPtr != (CPU_STK *)0) {           /* Unless the task was deleted meanwhile, ...             */
+        p_tcb->StkHighWaterPtr  = p_stk_mark;               /* ... remember the new mark                              */
+    }
+    CPU_CRITICAL_EXIT();
+
    *p_free = free_stk;
    *p_used = (p_tcb->StkSize - free_stk);                   /* Compute number of entries used on the stack            */
    *p_err  = OS_ERR_NONE;
@@ -2130,6 +2275,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TickNextPtr        = (OS_TCB        *)0;
     p_tcb->TickPrevPtr        = (OS_TCB        *)0;
     p_tcb->TickListPtr        = (OS_TICK_LIST  *)0;
+#if OS_CFG_TIME_HR_EN > 0u
+    p_tcb->TickHrTimeout      = (CPU_TS_TMR     )0;
+#endif
 
 #if OS_CFG_DBG_EN > 0u
     p_tcb->NamePtr            = (CPU_CHAR      *)((void *)"?Task");
@@ -2201,6 +2349,17 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
     p_tcb->StkFree            = (CPU_STK_SIZE   )0u;
     p_tcb->StkUsed            = (CPU_STK_SIZE   )0u;
+    p_tcb->StkHighWaterPtr    = (CPU_STK       *)0;
+#endif
+
+#if OS_CFG_SCHED_EDF_EN > 0u
+    p_tcb->EDFPeriod          = (OS_TICK        )0u;
+    p_tcb->EDFDeadlineRel     = (OS_TICK        )0u;
+    p_tcb->EDFRelease         = (OS_TICK        )0u;
+    p_tcb->EDFDeadline        = (OS_TICK        )0u;
+    p_tcb->EDFUtil            = (OS_CPU_USAGE   )0u;
+    p_tcb->EDFJobLate         = (CPU_BOOLEAN    )DEF_FALSE;
+    p_tcb->EDFMissCtr         = (OS_CTR         )0u;
 #endif
 
     p_tcb->Opt                = (OS_OPT         )0u;
@@ -2234,10 +2393,15 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TaskState          = (OS_STATE       )OS_TASK_STATE_RDY;
 
     p_tcb->Prio               = (OS_PRIO        )OS_PRIO_INIT;
-#if OS_CFG_MUTEX_EN > 0u
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_RWLOCK_EN > 0u)
     p_tcb->BasePrio           = (OS_PRIO        )OS_PRIO_INIT;
+#endif
+#if OS_CFG_MUTEX_EN > 0u
     p_tcb->MutexGrpHeadPtr    = (OS_MUTEX      *)0;
 #endif
+#if OS_CFG_RWLOCK_EN > 0u
+    p_tcb->RWLockGrpHeadPtr   = (OS_RWLOCK     *)0;
+#endif
 
 #if OS_CFG_DBG_EN > 0u
     p_tcb->DbgPrevPtr         = (OS_TCB        *)0;
@@ -2738,14 +2902,14 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                         OS_PRIO  prio_new)
 {
     OS_TCB  *p_tcb_owner;
-#if OS_CFG_MUTEX_EN > 0
+#if (OS_CFG_MUTEX_EN > 0) || (OS_CFG_RWLOCK_EN > 0u)
     OS_PRIO  prio_cur;
 #endif
 
 
     do {
         p_tcb_owner = (OS_TCB *)0;
-#if OS_CFG_MUTEX_EN > 0
+#if (OS_CFG_MUTEX_EN > 0) || (OS_CFG_RWLOCK_EN > 0u)
         prio_cur    = p_tcb->Prio;
 #endif
         switch (p_tcb->TaskState) {
@@ -2776,7 +2940,33 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                      case OS_TASK_PEND_ON_MULTI:
                      case OS_TASK_PEND_ON_Q:
                      case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_WAIT_SET:
+                          OS_PendListChangePrio(p_tcb);
+                          break;
+
+                     case OS_TASK_PEND_ON_RWLOCK_RD:
+                     case OS_TASK_PEND_ON_RWLOCK_WR:
+#if OS_CFG_RWLOCK_EN > 0u
                           OS_PendListChangePrio(p_tcb);
+                          p_tcb_owner = ((OS_RWLOCK *)p_tcb->PendDataTblPtr->PendObjPtr)->OwnerTCBPtr;
+                          if (p_tcb_owner == (OS_TCB *)0) {  /* Only a writer owner inherits                           */
+                              break;
+                          }
+                          if (prio_cur > prio_new) {         /* Are we increasing the priority?                        */
+                              if (p_tcb_owner->Prio <= prio_new) {/* Yes, do we need to give this prio to the writer?  */
+                                  p_tcb_owner = (OS_TCB *)0;
+                              }
+                          } else {
+                              if (p_tcb_owner->Prio == prio_cur) {/* No, is it required to check for a lower prio?     */
+                                  prio_new = OS_RWLockPrioFind(p_tcb_owner);
+                                  if (prio_new == p_tcb_owner->Prio) {
+                                      p_tcb_owner = (OS_TCB *)0;
+                                  }
+                              } else {
+                                  p_tcb_owner = (OS_TCB *)0;
+                              }
+                          }
+#endif
                           break;
 
                      case OS_TASK_PEND_ON_MUTEX:
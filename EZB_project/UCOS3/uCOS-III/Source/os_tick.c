@@ -45,9 +45,23 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 ************************************************************************************************************************
 */
 
+static  void    OS_TickUpdate            (void);
+
 static  CPU_TS  OS_TickListUpdateDly     (void);
 static  CPU_TS  OS_TickListUpdateTimeout (void);
 
+#if OS_CFG_TICK_DIRECT_EN > 0u
+static  OS_OBJ_QTY  OS_TickListDueCnt    (OS_TICK_LIST  *p_list,
+                                          OS_OBJ_QTY     limit);
+#endif
+
+static  void    OS_TickExpireDly         (OS_TCB  *p_tcb);
+static  void    OS_TickExpireTimeout     (OS_TCB  *p_tcb);
+
+#if OS_CFG_TIME_HR_EN > 0u
+static  void    OS_TickListRebaseHr      (void);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      TICK TASK
@@ -65,10 +79,6 @@ static  CPU_TS  OS_TickListUpdateTimeout (void);
 void  OS_TickTask (void  *p_arg)
 {
     OS_ERR  err;
-    CPU_TS  ts_delta;
-    CPU_TS  ts_delta_dly;
-    CPU_TS  ts_delta_timeout;
-    CPU_SR_ALLOC();
 
 
     (void)&p_arg;                                               /* Prevent compiler warning                             */
@@ -79,22 +89,101 @@ void  OS_TickTask (void  *p_arg)
                             (CPU_TS  *)0,
                             (OS_ERR  *)&err);                   /* Wait for signal from tick interrupt                  */
         if (err == OS_ERR_NONE) {
-            OS_CRITICAL_ENTER();
-            OSTickCtr++;                                        /* Keep track of the number of ticks                    */
-#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
-            TRACE_OS_TICK_INCREMENT(OSTickCtr);                 /* Record the event.                                    */
-#endif
-            OS_CRITICAL_EXIT();
-            ts_delta_dly     = OS_TickListUpdateDly();
-            ts_delta_timeout = OS_TickListUpdateTimeout();
-            ts_delta         = ts_delta_dly + ts_delta_timeout; /* Compute total execution time of list updates         */
-            if (OSTickTaskTimeMax < ts_delta) {
-                OSTickTaskTimeMax = ts_delta;
-            }
+            OS_TickUpdate();
         }
     }
 }
 
+/*
+************************************************************************************************************************
+*                                                  PROCESS ONE TICK
+*
+* Description: This function counts a tick and updates the tick lists.  It is called by the tick task, or by the tick
+*              ISR itself (see OS_TickUpdateDirect()).
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickUpdate (void)
+{
+    CPU_TS  ts_delta;
+    CPU_TS  ts_delta_dly;
+    CPU_TS  ts_delta_timeout;
+    CPU_SR_ALLOC();
+
+
+    OS_CRITICAL_ENTER();
+    OSTickCtr++;                                                /* Keep track of the number of ticks                    */
+#if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+    TRACE_OS_TICK_INCREMENT(OSTickCtr);                         /* Record the event.                                    */
+#endif
+    OS_CRITICAL_EXIT();
+    ts_delta_dly     = OS_TickListUpdateDly();
+    ts_delta_timeout = OS_TickListUpdateTimeout();
+    ts_delta         = ts_delta_dly + ts_delta_timeout;         /* Compute total execution time of list updates         */
+    if (OSTickTaskTimeMax < ts_delta) {
+        OSTickTaskTimeMax = ts_delta;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                          PROCESS ONE TICK IN THE TICK ISR
+*
+* Description: This function is called by OSTimeTick() to process the tick without switching to the tick task when
+*              few tasks become ready on this tick.
+*
+* Arguments  : none
+*
+* Returns    : DEF_TRUE      if the tick was processed.
+*              DEF_FALSE     if the tick must be handed to the tick task, either because more than
+*                            OS_CFG_TICK_DIRECT_BUDGET tasks become ready or because the tick task has not finished
+*                            processing previous ticks yet.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Ticks are processed in order: while the tick task is behind, every tick goes to the tick task.
+*
+*              3) The tasks due are counted before the lists are updated; the count stops at the budget, so the cost of
+*                 the check is bounded as well.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICK_DIRECT_EN > 0u
+CPU_BOOLEAN  OS_TickUpdateDirect (void)
+{
+    OS_OBJ_QTY  nbr_due;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if ((OSTickTaskTCB.TaskState != OS_TASK_STATE_PEND) ||              /* Tick task still busy with previous ticks          */
+        (OSTickTaskTCB.SemCtr    != (OS_SEM_CTR)0u)) {
+        OSTickFallbackCtr++;
+        CPU_CRITICAL_EXIT();
+        return (DEF_FALSE);
+    }
+    nbr_due = OS_TickListDueCnt(&OSTickListDly, (OS_OBJ_QTY)OS_CFG_TICK_DIRECT_BUDGET);
+    if (nbr_due <= (OS_OBJ_QTY)OS_CFG_TICK_DIRECT_BUDGET) {
+        nbr_due += OS_TickListDueCnt(&OSTickListTimeout, (OS_OBJ_QTY)OS_CFG_TICK_DIRECT_BUDGET - nbr_due);
+    }
+    if (nbr_due > (OS_OBJ_QTY)OS_CFG_TICK_DIRECT_BUDGET) {              /* Too much work for the ISR                         */
+        OSTickFallbackCtr++;
+        CPU_CRITICAL_EXIT();
+        return (DEF_FALSE);
+    }
+    CPU_CRITICAL_EXIT();
+
+    OS_TickUpdate();
+    return (DEF_TRUE);
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                 INITIALIZE TICK TASK
@@ -126,6 +215,9 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
 #endif
 
     OSTickCtr                    = (OS_TICK)0u;                         /* Clear the tick counter                            */
+#if OS_CFG_TICK_DIRECT_EN > 0u
+    OSTickFallbackCtr            = (OS_TICK)0u;
+#endif
 
     OSTickListDly.TCB_Ptr        = (OS_TCB   *)0;
     OSTickListTimeout.TCB_Ptr    = (OS_TCB   *)0;
@@ -138,6 +230,15 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
     OSTickListTimeout.NbrUpdated = (OS_OBJ_QTY)0;
 #endif
 
+#if OS_CFG_TIME_HR_EN > 0u
+    OSTickListHr.TCB_Ptr         = (OS_TCB   *)0;
+#if OS_CFG_DBG_EN > 0u
+    OSTickListHr.NbrEntries      = (OS_OBJ_QTY)0;
+    OSTickListHr.NbrUpdated      = (OS_OBJ_QTY)0;
+#endif
+    OSTickHrTs                   = (CPU_TS_TMR)0;
+#endif
+
                                                                         /* ---------------- CREATE THE TICK TASK ----------- */
     if (OSCfg_TickTaskStkBasePtr == (CPU_STK *)0) {
        *p_err = OS_ERR_TICK_STK_INVALID;
@@ -165,7 +266,7 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
                  (OS_MSG_QTY  )0u,
                  (OS_TICK     )0u,
                  (void       *)0,
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS),
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_NO_TLS),
                  (OS_ERR     *)p_err);
 }
 
@@ -461,12 +562,7 @@ static  CPU_TS  OS_TickListUpdateDly (void)
 #if OS_CFG_DBG_EN > 0u
             nbr_updated++;											    /* Keep track of the number of TCBs updated          */
 #endif
-            if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
-                p_tcb->TaskState = OS_TASK_STATE_RDY;
-                OS_RdyListInsert(p_tcb);                                /* Insert the task in the ready list                 */
-            } else if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
-                p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-            }
+            OS_TickExpireDly(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                          /* Get 'p_tcb' again for loop                        */
@@ -515,10 +611,6 @@ static  CPU_TS  OS_TickListUpdateTimeout (void)
     CPU_TS        ts_delta_timeout;
 #if OS_CFG_DBG_EN > 0u
     OS_OBJ_QTY    nbr_updated;
-#endif
-#if OS_CFG_MUTEX_EN > 0u
-    OS_TCB       *p_tcb_owner;
-    OS_PRIO       prio_new;
 #endif
     CPU_SR_ALLOC();
 
@@ -538,44 +630,7 @@ static  CPU_TS  OS_TickListUpdateTimeout (void)
             nbr_updated++;
 #endif
 
-#if OS_CFG_MUTEX_EN > 0u
-            p_tcb_owner = (OS_TCB *)0;
-            if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                p_tcb_owner = ((OS_MUTEX *)p_tcb->PendDataTblPtr->PendObjPtr)->OwnerTCBPtr;
-            }
-#endif
-
-#if (OS_MSG_EN > 0u)
-            p_tcb->MsgPtr  = (void      *)0;
-            p_tcb->MsgSize = (OS_MSG_SIZE)0u;
-#endif
-            p_tcb->TS      = OS_TS_GET();
-            OS_PendListRemove(p_tcb);                                   /* Remove from wait list                             */
-            if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-                OS_RdyListInsert(p_tcb);                                /* Insert the task in the ready list                 */
-                p_tcb->TaskState  = OS_TASK_STATE_RDY;
-            } else if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
-
-                p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-            }
-            p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                 /* Indicate pend timed out                           */
-            p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                        */
-
-#if OS_CFG_MUTEX_EN > 0u
-            if(p_tcb_owner != (OS_TCB *)0) {
-                if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                    (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?               */
-                    prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                    prio_new = prio_new > p_tcb_owner->BasePrio ? p_tcb_owner->BasePrio : prio_new;
-                    if(prio_new != p_tcb_owner->Prio) {
-                        OS_TaskChangePrio(p_tcb_owner, prio_new);
-            #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
-                                      TRACE_OS_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio)
-            #endif
-                    }
-                }
-            }
-#endif
+            OS_TickExpireTimeout(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                          /* Get 'p_tcb' again for loop                        */
@@ -600,3 +655,275 @@ static  CPU_TS  OS_TickListUpdateTimeout (void)
 
     return (ts_delta_timeout);
 }
+
+/*
+************************************************************************************************************************
+*                                         COUNT THE TASKS DUE ON THE NEXT TICK
+*
+* Description: This function counts the tasks of a tick list that become ready on the next tick.
+*
+* Arguments  : p_list         is a pointer to the tick list
+*
+*              limit          is the count above which the caller is not interested in the exact number
+*
+* Returns    : The number of tasks due, at most 'limit + 1'.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TICK_DIRECT_EN > 0u
+static  OS_OBJ_QTY  OS_TickListDueCnt (OS_TICK_LIST  *p_list,
+                                       OS_OBJ_QTY     limit)
+{
+    OS_TCB      *p_tcb;
+    OS_OBJ_QTY   nbr_due;
+
+
+    p_tcb = p_list->TCB_Ptr;
+    if ((p_tcb == (OS_TCB *)0) || (p_tcb->TickRemain > (OS_TICK)1u)) {  /* Head of the list not due on the next tick         */
+        return ((OS_OBJ_QTY)0u);
+    }
+    nbr_due = (OS_OBJ_QTY)1u;
+    p_tcb   = p_tcb->TickNextPtr;
+    while ((p_tcb   != (OS_TCB *)0)  &&                                 /* Followers with a delta of 0 expire with the head  */
+           (p_tcb->TickRemain == (OS_TICK)0u) &&
+           (nbr_due <= limit)) {
+        nbr_due++;
+        p_tcb = p_tcb->TickNextPtr;
+    }
+    return (nbr_due);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                              EXPIRE A TASK'S DELAY
+*
+* Description: This function readies a task whose delay expired.  The caller unlinks the task from its tick list.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickExpireDly (OS_TCB  *p_tcb)
+{
+    if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
+        p_tcb->TaskState = OS_TASK_STATE_RDY;
+        OS_RdyListInsert(p_tcb);                                        /* Insert the task in the ready list                 */
+    } else if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
+        p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                             EXPIRE A TASK'S PEND TIMEOUT
+*
+* Description: This function ends the pend of a task whose timeout expired.  The caller unlinks the task from its tick
+*              list.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickExpireTimeout (OS_TCB  *p_tcb)
+{
+#if OS_CFG_MUTEX_EN > 0u
+    OS_TCB   *p_tcb_owner;
+    OS_PRIO   prio_new;
+#endif
+
+
+#if OS_CFG_MUTEX_EN > 0u
+    p_tcb_owner = (OS_TCB *)0;
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+        p_tcb_owner = ((OS_MUTEX *)p_tcb->PendDataTblPtr->PendObjPtr)->OwnerTCBPtr;
+    }
+#endif
+
+#if (OS_MSG_EN > 0u)
+    p_tcb->MsgPtr  = (void      *)0;
+    p_tcb->MsgSize = (OS_MSG_SIZE)0u;
+#endif
+    p_tcb->TS      = OS_TS_GET();
+#if OS_CFG_RWLOCK_EN > 0u
+    if ((p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_RD) ||
+        (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_WR)) {
+        OS_RWLockPendRemove(p_tcb);                                     /* Also lowers the writer we lent our priority to    */
+    } else {
+        OS_PendListRemove(p_tcb);                                       /* Remove from wait list                             */
+    }
+#else
+    OS_PendListRemove(p_tcb);                                           /* Remove from wait list                             */
+#endif
+    if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
+        OS_RdyListInsert(p_tcb);                                        /* Insert the task in the ready list                 */
+        p_tcb->TaskState  = OS_TASK_STATE_RDY;
+    } else if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
+
+        p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+    }
+    p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                         /* Indicate pend timed out                           */
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                        /* Indicate no longer pending                        */
+
+#if OS_CFG_MUTEX_EN > 0u
+    if(p_tcb_owner != (OS_TCB *)0) {
+        if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+            (p_tcb_owner->Prio == p_tcb->Prio)) {                       /* Has the owner inherited a priority?               */
+            prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+            prio_new = prio_new > p_tcb_owner->BasePrio ? p_tcb_owner->BasePrio : prio_new;
+            if(prio_new != p_tcb_owner->Prio) {
+                OS_TaskChangePrio(p_tcb_owner, prio_new);
+    #if (defined(TRACE_CFG_EN) && (TRACE_CFG_EN > 0u))
+                              TRACE_OS_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio)
+    #endif
+            }
+        }
+    }
+#endif
+}
+
+
+#if OS_CFG_TIME_HR_EN > 0u
+/*
+************************************************************************************************************************
+*                                       ADD TASK TO HIGH-RESOLUTION TICK LIST
+*
+* Description: This function places a task in the list of tasks waiting on the high-resolution timer.  The list is a
+*              delta list like the other tick lists, except that .TickRemain holds CPU_TS timer counts instead of ticks.
+*              The BSP is asked to interrupt when the earliest task is due, and calls OSTimeTickHr() at that time.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to add to the list
+*              -----
+*
+*              cycles         is the time (in CPU_TS timer counts) from now for the task to become ready
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The caller sets .TaskState, which tells OS_TickListUpdateHr() whether the task is delayed or pending.
+************************************************************************************************************************
+*/
+
+void  OS_TickListInsertHr (OS_TCB      *p_tcb,
+                           CPU_TS_TMR   cycles)
+{
+    OS_TickListRebaseHr();                                              /* Make the first delta relative to now              */
+    OS_TickListInsert(&OSTickListHr, p_tcb, (OS_TICK)cycles);
+    if (OSTickListHr.TCB_Ptr == p_tcb) {                                /* New earliest deadline, re-arm the timer           */
+        OS_TickHrTmrSet(cycles);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       UPDATE THE HIGH-RESOLUTION TICK LIST
+*
+* Description: This function readies the tasks of the high-resolution tick list that are due, and re-arms the timer
+*              for the next one.  It is called by OSTimeTickHr() from the BSP's timer ISR.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Tasks removed from the list before they were due (posted, resumed, deleted) do not re-arm the timer;
+*                 the interrupt that was armed for them finds nothing due and only re-arms the timer.
+************************************************************************************************************************
+*/
+
+void  OS_TickListUpdateHr (void)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+    CPU_CRITICAL_ENTER();
+    OS_TickListRebaseHr();
+    p_tcb = OSTickListHr.TCB_Ptr;
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->TickRemain != (OS_TICK)0u) {                         /* Not due yet, wait for it                          */
+            OS_TickHrTmrSet((CPU_TS_TMR)p_tcb->TickRemain);
+            break;
+        }
+        OS_TickListRemove(p_tcb);
+        if ((p_tcb->TaskState == OS_TASK_STATE_DLY) ||
+            (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED)) {
+            OS_TickExpireDly(p_tcb);
+        } else {
+            OS_TickExpireTimeout(p_tcb);
+        }
+        p_tcb = OSTickListHr.TCB_Ptr;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                   REBASE THE HIGH-RESOLUTION TICK LIST ON THE TIMER
+*
+* Description: This function subtracts the time elapsed since the last call from the deltas at the head of the
+*              high-resolution tick list, so that the first delta is relative to now.  Tasks that are due are left at
+*              the head of the list with a delta of 0.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The timer wraps around, so the list must be rebased at least once per timer period.  The BSP bounds
+*                 the time it arms the timer for (see OS_TickHrTmrSet()).
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListRebaseHr (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_TS_TMR   ts;
+    CPU_TS_TMR   elapsed;
+
+
+    ts         = CPU_TS_TmrRd();
+    elapsed    = ts - OSTickHrTs;
+    OSTickHrTs = ts;
+    p_tcb      = OSTickListHr.TCB_Ptr;
+    while ((p_tcb != (OS_TCB *)0) && (elapsed > (CPU_TS_TMR)0u)) {
+        if (p_tcb->TickRemain > (OS_TICK)elapsed) {
+            p_tcb->TickRemain -= (OS_TICK)elapsed;
+            elapsed            = (CPU_TS_TMR)0u;
+        } else {
+            elapsed           -= (CPU_TS_TMR)p_tcb->TickRemain;         /* Task is due                                       */
+            p_tcb->TickRemain  = (OS_TICK)0u;
+            p_tcb              = p_tcb->TickNextPtr;
+        }
+    }
+}
+#endif
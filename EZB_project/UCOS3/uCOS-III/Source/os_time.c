@@ -39,6 +39,16 @@
 const  CPU_CHAR  *os_time__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TIME_HR_EN > 0u
+static  CPU_TS_TMR  OS_TimeUsToCycles (CPU_INT32U  us);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  DELAY TASK 'n' TICKS
@@ -445,6 +455,225 @@ void  OSTimeDlyResume (OS_TCB  *p_tcb,
 }
 #endif
 
+#if OS_CFG_TIME_HR_EN > 0u
+/*
+************************************************************************************************************************
+*                                             DELAY TASK 'n' TIMER CYCLES
+*
+* Description: This function is called to delay execution of the currently running task for a number of CPU_TS timer
+*              counts (CPU clock cycles on most targets).  The delay does not depend on the tick rate: the BSP's
+*              high-resolution timer interrupts when the delay expires (see OS_TickHrTmrSet()).
+*
+* Arguments  : cycles    is the number of CPU_TS timer counts to delay for.  Note that specifying 0 means the task is
+*                        not to delay.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE            the call was successful and the delay occurred.
+*                            OS_ERR_SCHED_LOCKED    can't delay when the scheduler is locked.
+*                            OS_ERR_TIME_DLY_ISR    if you called this function from an ISR.
+*                            OS_ERR_TIME_ZERO_DLY   if you specified a delay of zero.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The task is readied by the timer ISR itself, so the delay is only lengthened by the interrupt latency
+*                 and by higher priority tasks.  Delays of several ticks are better served by OSTimeDly(), which
+*                 does not need a timer interrupt per delay.
+*
+*              2) OSTimeDlyResume() can end this delay early.
+************************************************************************************************************************
+*/
+
+void  OSTimeDlyCycles (CPU_TS_TMR   cycles,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {             /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0u) {       /* Can't delay when the scheduler is locked               */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    if (cycles == (CPU_TS_TMR)0u) {                         /* 0 means no delay!                                      */
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    OS_CRITICAL_ENTER();
+    OSTCBCurPtr->TaskState = OS_TASK_STATE_DLY;
+    OS_TickListInsertHr(OSTCBCurPtr, cycles);
+    OS_RdyListRemove(OSTCBCurPtr);                          /* Remove current task from ready list                    */
+    OS_CRITICAL_EXIT_NO_SCHED();
+    OSSched();                                              /* Find next task to run!                                 */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           DELAY TASK FOR 'n' MICROSECONDS
+*
+* Description: This function is called to delay execution of the currently running task for a number of microseconds.
+*              See OSTimeDlyCycles().
+*
+* Arguments  : us        is the number of microseconds to delay for.  Note that specifying 0 means the task is not to
+*                        delay.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE                        the call was successful and the delay occurred.
+*                            OS_ERR_SCHED_LOCKED                can't delay when the scheduler is locked.
+*                            OS_ERR_TIME_DLY_ISR                if you called this function from an ISR.
+*                            OS_ERR_TIME_INVALID_MICROSECONDS   if 'us' does not fit in the CPU_TS timer, or the timer
+*                                                               frequency is unknown.
+*                            OS_ERR_TIME_ZERO_DLY               if you specified a delay of zero.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSTimeDlyUs (CPU_INT32U   us,
+                   OS_ERR      *p_err)
+{
+    CPU_TS_TMR  cycles;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (us == (CPU_INT32U)0u) {                             /* 0 means no delay!                                      */
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    cycles = OS_TimeUsToCycles(us);
+    if (cycles == (CPU_TS_TMR)0u) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+        return;
+    }
+
+    OSTimeDlyCycles(cycles, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    SET A HIGH-RESOLUTION TIMEOUT FOR THE NEXT PEND
+*
+* Description: This function sets the timeout of the next pend of the calling task that blocks, in CPU_TS timer counts.
+*              The timeout is handled by the BSP's high-resolution timer like OSTimeDlyCycles(), and replaces the
+*              'timeout' argument of that pend call.  It applies to every kernel object the task can pend on.
+*
+* Arguments  : cycles    is the timeout in CPU_TS timer counts.  Specifying 0 cancels a timeout that was set but not
+*                        used yet.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE            the timeout is set.
+*                            OS_ERR_TIME_DLY_ISR    if you called this function from an ISR.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The timeout is used by the first pend that blocks the task, and only by that pend.  A pend that
+*                 returns without blocking (the object was available, or OS_OPT_PEND_NON_BLOCKING) leaves the timeout
+*                 set for the next one, so call this function with 0 if the timeout must not carry over:
+*
+*                     OSTimeTimeoutSetUs(250u, &err);
+*                     OSSemPend(&sem, 0u, OS_OPT_PEND_BLOCKING, &ts, &err);    (OS_ERR_TIMEOUT after 250 us)
+*                     OSTimeTimeoutSetCycles(0u, &err);
+************************************************************************************************************************
+*/
+
+void  OSTimeTimeoutSetCycles (CPU_TS_TMR   cycles,
+                              OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {             /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+    OSTCBCurPtr->TickHrTimeout = cycles;                    /* Only the task itself reads it, in OS_TaskBlock()       */
+   *p_err                      = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                 SET A MICROSECOND TIMEOUT FOR THE NEXT PEND
+*
+* Description: This function sets the timeout of the next pend of the calling task that blocks, in microseconds.  See
+*              OSTimeTimeoutSetCycles().
+*
+* Arguments  : us        is the timeout in microseconds.  Specifying 0 cancels a timeout that was set but not used yet.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE                        the timeout is set.
+*                            OS_ERR_TIME_DLY_ISR                if you called this function from an ISR.
+*                            OS_ERR_TIME_INVALID_MICROSECONDS   if 'us' does not fit in the CPU_TS timer, or the timer
+*                                                               frequency is unknown.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSTimeTimeoutSetUs (CPU_INT32U   us,
+                          OS_ERR      *p_err)
+{
+    CPU_TS_TMR  cycles;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    cycles = (CPU_TS_TMR)0u;
+    if (us > (CPU_INT32U)0u) {
+        cycles = OS_TimeUsToCycles(us);
+        if (cycles == (CPU_TS_TMR)0u) {
+           *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+            return;
+        }
+    }
+
+    OSTimeTimeoutSetCycles(cycles, p_err);
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               GET CURRENT SYSTEM TIME
@@ -528,6 +757,10 @@ void  OSTimeSet (OS_TICK   ticks,
 * Arguments  : none
 *
 * Returns    : none
+*
+* Note(s)    : 1) With OS_CFG_TICK_DIRECT_EN, the tick lists are updated right here when at most
+*                 OS_CFG_TICK_DIRECT_BUDGET tasks become ready, which saves switching to the tick task and back.
+*                 Busier ticks are still handed to the tick task.
 ************************************************************************************************************************
 */
 
@@ -541,6 +774,10 @@ void  OSTimeTick (void)
 
     OSTimeTickHook();                                       /* Call user definable hook                               */
 
+#if OS_CFG_SCHED_TBL_EN > 0u
+    OS_SchedTblUpdate();                                    /* Tick the schedule tables from the ISR itself           */
+#endif
+
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
 
     ts = OS_TS_GET();                                       /* Get timestamp                                          */
@@ -555,9 +792,17 @@ void  OSTimeTick (void)
 
 #else
 
+#if OS_CFG_TICK_DIRECT_EN > 0u
+    if (OS_TickUpdateDirect() == DEF_FALSE) {               /* Process the tick here unless it is over budget         */
+       (void)OSTaskSemPost((OS_TCB *)&OSTickTaskTCB,        /* Signal tick task                                       */
+                           (OS_OPT  ) OS_OPT_POST_NONE,
+                           (OS_ERR *)&err);
+    }
+#else
    (void)OSTaskSemPost((OS_TCB *)&OSTickTaskTCB,            /* Signal tick task                                       */
                        (OS_OPT  ) OS_OPT_POST_NONE,
                        (OS_ERR *)&err);
+#endif
 
 
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
@@ -576,3 +821,59 @@ void  OSTimeTick (void)
 
 #endif
 }
+
+/*
+************************************************************************************************************************
+*                                        PROCESS HIGH-RESOLUTION TIMER INTERRUPT
+*
+* Description: This function is used to signal to uC/OS-III that the high-resolution timer armed by OS_TickHrTmrSet()
+*              expired.  This function should be called by the BSP's timer ISR.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The delayed and pending tasks that are due are readied from the ISR itself, the context switch
+*                 happens in OSIntExit().
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TIME_HR_EN > 0u
+void  OSTimeTickHr (void)
+{
+    OS_TickListUpdateHr();
+}
+
+
+/*
+************************************************************************************************************************
+*                                       CONVERT MICROSECONDS TO TIMER CYCLES
+*
+* Description: This function converts a number of microseconds to CPU_TS timer counts.
+*
+* Arguments  : us        is the number of microseconds.
+*
+* Returns    : The number of CPU_TS timer counts, or 0 if it does not fit in a CPU_TS_TMR or the timer frequency is
+*              unknown.
+*
+* Note(s)    : 1) The timer frequency is truncated to whole MHz to avoid a 64-bit division, which is exact for the
+*                 usual CPU clocks.
+************************************************************************************************************************
+*/
+
+static  CPU_TS_TMR  OS_TimeUsToCycles (CPU_INT32U  us)
+{
+    CPU_TS_TMR_FREQ  freq_mhz;
+    CPU_ERR          cpu_err;
+
+
+    freq_mhz = CPU_TS_TmrFreqGet(&cpu_err) / (CPU_TS_TMR_FREQ)1000000u;
+    if (freq_mhz == (CPU_TS_TMR_FREQ)0u) {                  /* Frequency not set by CPU_TS_TmrInit()                  */
+        return ((CPU_TS_TMR)0u);
+    }
+    if (us > (DEF_INT_32U_MAX_VAL / freq_mhz)) {            /* Would overflow the timer                               */
+        return ((CPU_TS_TMR)0u);
+    }
+    return ((CPU_TS_TMR)(us * freq_mhz));
+}
+#endif
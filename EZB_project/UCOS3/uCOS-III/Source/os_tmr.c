@@ -902,7 +902,7 @@ void  OS_TmrInit (OS_ERR  *p_err)
                  (OS_MSG_QTY  )0,
                  (OS_TICK     )0,
                  (void       *)0,
-                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS),
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_NO_TLS),
                  (OS_ERR     *)p_err);
 }
 
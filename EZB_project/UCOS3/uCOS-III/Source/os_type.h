@@ -82,6 +82,9 @@ typedef   CPU_INT32U      OS_REG;                      /* Task register
 typedef   CPU_INT08U      OS_REG_ID;                   /* Index to task register                            <8>/16/32 */
 
 typedef   CPU_INT32U      OS_SEM_CTR;                  /* Semaphore value                                     16/<32> */
+#define   OS_SEM_CTR_SIZE CPU_WORD_SIZE_32             /* Size of OS_SEM_CTR (in octets), keep it in sync          */
+
+typedef   CPU_INT32U      OS_SEQ_CTR;                  /* Sequence lock counter                               16/<32> */
 
 typedef   CPU_INT08U      OS_STATE;                    /* State variable                                    <8>/16/32 */
 
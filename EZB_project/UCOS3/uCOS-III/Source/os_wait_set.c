@@ -0,0 +1,747 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                 WAIT SET MANAGEMENT
+*
+* File    : OS_WAIT_SET.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A wait set is the persistent counterpart of OSPendMulti().  Objects are registered once with
+*               OSWaitSetAdd() instead of being validated, scanned and inserted into every pend list on each call.
+*               OS_SemPost() and OS_QPost() notify the set through OS_WaitSetSignal() when no task pends on the
+*               object itself, so a wakeup costs O(1) plus the number of ready objects.
+*
+*           (2) The set is level-triggered: an object stays in the ready list for as long as it holds a count or a
+*               message, and is rotated to the tail after each OSWaitSetPend() so that busy objects cannot starve
+*               the others.  Entries whose count was taken directly with OSSemPend()/OSQPend() are dropped lazily.
+*
+*           (3) A task pending directly on a registered object has precedence over the set.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_wait_set__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_WAIT_SET_EN > 0u
+/*
+************************************************************************************************************************
+*                                              REGISTER AN OBJECT IN A WAIT SET
+*
+* Description: This function adds a semaphore or a message queue to a wait set.  An object can belong to one set at a
+*              time.  If the object already holds a count or messages, it is immediately considered ready.
+*
+* Arguments  : p_set         is a pointer to the wait set
+*
+*              p_entry       is a pointer to storage supplied by the caller to link the object to the set.  It must
+*                            remain valid until the object is removed with OSWaitSetRemove() or deleted.
+*
+*              p_obj         is a pointer to the semaphore or message queue to register
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_CREATE_ISR              if you called this function from an ISR
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_set', 'p_entry' or 'p_obj' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                if 'p_set' is not a wait set or 'p_obj' is neither a
+*                                                                 semaphore nor a message queue
+*                                OS_ERR_WAIT_SET_MEMBER         if 'p_obj' is already registered in a wait set
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSWaitSetAdd (OS_WAIT_SET        *p_set,
+                    OS_WAIT_SET_ENTRY  *p_entry,
+                    OS_PEND_OBJ        *p_obj,
+                    OS_ERR             *p_err)
+{
+    OS_WAIT_SET_ENTRY  **pp_entry;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_set   == (OS_WAIT_SET       *)0) ||              /* Validate arguments                                     */
+        (p_entry == (OS_WAIT_SET_ENTRY *)0) ||
+        (p_obj   == (OS_PEND_OBJ       *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_set->Type != OS_OBJ_TYPE_WAIT_SET) {              /* Make sure wait set was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    switch (p_obj->Type) {                                  /* Only semaphores and queues can notify a set            */
+#if OS_CFG_SEM_EN > 0u
+        case OS_OBJ_TYPE_SEM:
+             pp_entry = &((OS_SEM *)((void *)p_obj))->WaitSetEntryPtr;
+             break;
+#endif
+
+#if OS_CFG_Q_EN > 0u
+        case OS_OBJ_TYPE_Q:
+             pp_entry = &((OS_Q *)((void *)p_obj))->WaitSetEntryPtr;
+             break;
+#endif
+
+        default:
+            *p_err = OS_ERR_OBJ_TYPE;
+             return;
+    }
+
+    OS_CRITICAL_ENTER();
+    if (*pp_entry != (OS_WAIT_SET_ENTRY *)0) {              /* Already registered?                                    */
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_WAIT_SET_MEMBER;
+        return;
+    }
+    p_entry->SetPtr     =  p_set;
+    p_entry->ObjPtr     =  p_obj;
+    p_entry->RdyNextPtr = (OS_WAIT_SET_ENTRY *)0;
+    p_entry->RdyFlag    =  DEF_FALSE;
+   *pp_entry            =  p_entry;
+    p_set->NbrEntries++;
+
+    OS_WaitSetSignal(p_entry);                              /* Object may already hold a count or messages            */
+    OS_CRITICAL_EXIT_NO_SCHED();
+
+    OSSched();                                              /* A task pending on the set may have been readied        */
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  CREATE A WAIT SET
+*
+* Description: This function creates an empty wait set.
+*
+* Arguments  : p_set         is a pointer to the wait set to initialize.  Your application is responsible for
+*                            allocating storage for the set.
+*
+*              p_name        is a pointer to the name you would like to give the wait set.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_CREATE_ISR              if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the set after you called
+*                                                                 OSSafetyCriticalStart().
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_set' is a NULL pointer
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSWaitSetCreate (OS_WAIT_SET  *p_set,
+                       CPU_CHAR     *p_name,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_set == (OS_WAIT_SET *)0) {                        /* Validate 'p_set'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+#if OS_OBJ_TYPE_REQ > 0u
+    p_set->Type       =  OS_OBJ_TYPE_WAIT_SET;              /* Mark the data structure as a wait set                  */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_set->NamePtr    =  p_name;
+#else
+    (void)&p_name;
+#endif
+    p_set->RdyHeadPtr = (OS_WAIT_SET_ENTRY *)0;
+    p_set->RdyTailPtr = (OS_WAIT_SET_ENTRY *)0;
+    p_set->NbrEntries = (OS_OBJ_QTY         )0;
+    OS_PendListInit(&p_set->PendList);                      /* Initialize the waiting list                            */
+    OS_CRITICAL_EXIT_NO_SCHED();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  PEND ON A WAIT SET
+*
+* Description: This function waits until one of the objects registered in the set has been posted and takes one count
+*              (semaphore) or one message (queue) from it.
+*
+* Arguments  : p_set         is a pointer to the wait set
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                            an object up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever.
+*
+*              opt           determines whether the user wants to block if no object is ready:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_msg         is a pointer to a variable that will receive the message if the ready object is a
+*                            message queue, or a NULL pointer for a semaphore.  May be a NULL pointer.
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the message.  May be a NULL
+*                            pointer.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the object was
+*                            posted.  May be a NULL pointer.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               An object was ready; it is returned
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_set' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_set' is not a wait set
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no object was ready
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No object was posted within the specified timeout
+*
+* Returns    : A pointer to the semaphore or message queue that was taken from, or a NULL pointer upon error.
+************************************************************************************************************************
+*/
+
+OS_PEND_OBJ  *OSWaitSetPend (OS_WAIT_SET   *p_set,
+                             OS_TICK        timeout,
+                             OS_OPT         opt,
+                             void         **p_msg,
+                             OS_MSG_SIZE   *p_msg_size,
+                             CPU_TS        *p_ts,
+                             OS_ERR        *p_err)
+{
+    OS_PEND_DATA   pend_data;
+    OS_PEND_OBJ   *p_obj;
+    void          *p_void;
+    OS_MSG_SIZE    msg_size;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_set == (OS_WAIT_SET *)0) {                        /* Validate arguments                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_PEND_OBJ *)0);
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_set->Type != OS_OBJ_TYPE_WAIT_SET) {              /* Make sure wait set was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_obj = OS_WaitSetGetRdy(p_set,                         /* Any registered object ready?                           */
+                             &p_void,
+                             &msg_size,
+                             &ts);
+    if (p_obj == (OS_PEND_OBJ *)0) {
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;                /* No, caller does not want to block                      */
+            return ((OS_PEND_OBJ *)0);
+        }
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    /* Can't pend when the scheduler is locked                */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((OS_PEND_OBJ *)0);
+        }
+                                                            /* Lock the scheduler/re-enable interrupts                */
+        OS_CRITICAL_ENTER_CPU_EXIT();
+        OS_Pend(&pend_data,                                 /* Block task pending on the set                          */
+                (OS_PEND_OBJ *)((void *)p_set),
+                 OS_TASK_PEND_ON_WAIT_SET,
+                 timeout);
+        OS_CRITICAL_EXIT_NO_SCHED();
+
+        OSSched();                                          /* Find next highest priority task ready to run           */
+
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {
+            case OS_STATUS_PEND_OK:                         /* OS_WaitSetSignal() handed us an object                 */
+                 p_obj    = pend_data.RdyObjPtr;
+                 p_void   = pend_data.RdyMsgPtr;
+                 msg_size = pend_data.RdyMsgSize;
+                 ts       = pend_data.RdyTS;
+                 break;
+
+            case OS_STATUS_PEND_TIMEOUT:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TIMEOUT;
+                 return ((OS_PEND_OBJ *)0);
+
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_STATUS_INVALID;
+                 return ((OS_PEND_OBJ *)0);
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_msg != (void **)0) {
+       *p_msg = p_void;
+    }
+    if (p_msg_size != (OS_MSG_SIZE *)0) {
+       *p_msg_size = msg_size;
+    }
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = ts;
+    }
+   *p_err = OS_ERR_NONE;
+    return (p_obj);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            UNREGISTER AN OBJECT FROM ITS WAIT SET
+*
+* Description: This function removes a semaphore or a message queue from the wait set it was added to.
+*
+* Arguments  : p_entry       is a pointer to the entry that was passed to OSWaitSetAdd()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_DEL_ISR                 if you called this function from an ISR
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_entry' is a NULL pointer
+*                                OS_ERR_WAIT_SET_NOT_MEMBER     if 'p_entry' does not link an object to a set
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSWaitSetRemove (OS_WAIT_SET_ENTRY  *p_entry,
+                       OS_ERR             *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_DEL_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_entry == (OS_WAIT_SET_ENTRY *)0) {                /* Validate 'p_entry'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    OS_CRITICAL_ENTER();
+    if (p_entry->SetPtr == (OS_WAIT_SET *)0) {
+        OS_CRITICAL_EXIT();
+       *p_err = OS_ERR_WAIT_SET_NOT_MEMBER;
+        return;
+    }
+    OS_WaitSetEntryRemove(p_entry);
+    OS_CRITICAL_EXIT_NO_SCHED();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             UNLINK AN ENTRY FROM ITS SET
+*
+* Description: This function is called by OSWaitSetRemove(), OS_SemClr() and OS_QClr() to remove an object from the
+*              set it is registered in.
+*
+* Arguments  : p_entry       is a pointer to the entry to remove
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with the scheduler locked or interrupts disabled.
+*
+*              3) The ready list is singly linked; removing an entry that is ready walks the ready list.
+************************************************************************************************************************
+*/
+
+void  OS_WaitSetEntryRemove (OS_WAIT_SET_ENTRY  *p_entry)
+{
+    OS_WAIT_SET         *p_set;
+    OS_WAIT_SET_ENTRY  **pp_entry;
+    OS_WAIT_SET_ENTRY   *p_prev;
+
+
+
+    p_set = p_entry->SetPtr;
+    if (p_entry->RdyFlag == DEF_TRUE) {                     /* Unlink from the ready list                             */
+        p_prev   = (OS_WAIT_SET_ENTRY  *)0;
+        pp_entry = &p_set->RdyHeadPtr;
+        while (*pp_entry != p_entry) {
+            p_prev   = *pp_entry;
+            pp_entry = &(*pp_entry)->RdyNextPtr;
+        }
+       *pp_entry = p_entry->RdyNextPtr;
+        if (p_set->RdyTailPtr == p_entry) {
+            p_set->RdyTailPtr = p_prev;
+        }
+    }
+
+    switch (p_entry->ObjPtr->Type) {                        /* Detach the object                                      */
+#if OS_CFG_SEM_EN > 0u
+        case OS_OBJ_TYPE_SEM:
+             ((OS_SEM *)((void *)p_entry->ObjPtr))->WaitSetEntryPtr = (OS_WAIT_SET_ENTRY *)0;
+             break;
+#endif
+
+#if OS_CFG_Q_EN > 0u
+        case OS_OBJ_TYPE_Q:
+             ((OS_Q   *)((void *)p_entry->ObjPtr))->WaitSetEntryPtr = (OS_WAIT_SET_ENTRY *)0;
+             break;
+#endif
+
+        default:
+             break;
+    }
+
+    p_set->NbrEntries--;
+    p_entry->SetPtr     = (OS_WAIT_SET       *)0;
+    p_entry->ObjPtr     = (OS_PEND_OBJ       *)0;
+    p_entry->RdyNextPtr = (OS_WAIT_SET_ENTRY *)0;
+    p_entry->RdyFlag    =  DEF_FALSE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          TAKE FROM THE FIRST READY OBJECT
+*
+* Description: This function is called by OSWaitSetPend() to take one count or message from the first object of the
+*              set's ready list.
+*
+* Arguments  : p_set         is a pointer to the wait set
+*
+*              p_msg         is a pointer to where the message (if any) will be deposited
+*
+*              p_msg_size    is a pointer to where the size of the message will be deposited
+*
+*              p_ts          is a pointer to where the timestamp of the post will be deposited
+*
+* Returns    : A pointer to the object taken from, or a NULL pointer if no registered object is ready.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with interrupts disabled.
+*
+*              3) An object that is still ready after the take is moved to the tail of the ready list (see Note #2 at
+*                 the top of this file).  Entries found empty are dropped.
+************************************************************************************************************************
+*/
+
+OS_PEND_OBJ  *OS_WaitSetGetRdy (OS_WAIT_SET   *p_set,
+                                void         **p_msg,
+                                OS_MSG_SIZE   *p_msg_size,
+                                CPU_TS        *p_ts)
+{
+    OS_WAIT_SET_ENTRY  *p_entry;
+
+
+
+    while (p_set->RdyHeadPtr != (OS_WAIT_SET_ENTRY *)0) {
+        p_entry           = p_set->RdyHeadPtr;              /* Pop the oldest ready entry                             */
+        p_set->RdyHeadPtr = p_entry->RdyNextPtr;
+        if (p_set->RdyHeadPtr == (OS_WAIT_SET_ENTRY *)0) {
+            p_set->RdyTailPtr = (OS_WAIT_SET_ENTRY *)0;
+        }
+        p_entry->RdyNextPtr = (OS_WAIT_SET_ENTRY *)0;
+        p_entry->RdyFlag    =  DEF_FALSE;
+
+        if (OS_WaitSetObjGet(p_entry->ObjPtr, p_msg, p_msg_size, p_ts) == DEF_TRUE) {
+            if (OS_WaitSetObjRdy(p_entry->ObjPtr) == DEF_TRUE) {
+                OS_WaitSetRdyAppend(p_entry);               /* Still ready, give the others a turn first              */
+            }
+            return (p_entry->ObjPtr);
+        }
+    }
+    return ((OS_PEND_OBJ *)0);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           TAKE / TEST A REGISTERED OBJECT
+*
+* Description: OS_WaitSetObjGet() takes one count from a semaphore or one message from a message queue.
+*              OS_WaitSetObjRdy() tells whether the object holds a count or a message.
+*
+* Arguments  : p_obj         is a pointer to the semaphore or message queue
+*
+*              p_msg         is a pointer to where the message (NULL for a semaphore) will be deposited
+*
+*              p_msg_size    is a pointer to where the size of the message will be deposited
+*
+*              p_ts          is a pointer to where the timestamp of the post will be deposited
+*
+* Returns    : DEF_TRUE      if a count or a message was taken (OS_WaitSetObjGet()) or is available
+*                            (OS_WaitSetObjRdy()).
+*              DEF_FALSE     otherwise.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_WaitSetObjGet (OS_PEND_OBJ   *p_obj,
+                               void         **p_msg,
+                               OS_MSG_SIZE   *p_msg_size,
+                               CPU_TS        *p_ts)
+{
+#if OS_CFG_SEM_EN > 0u
+    OS_SEM  *p_sem;
+#endif
+#if OS_CFG_Q_EN > 0u
+    OS_Q    *p_q;
+    OS_ERR   err;
+#endif
+
+
+
+    switch (p_obj->Type) {
+#if OS_CFG_SEM_EN > 0u
+        case OS_OBJ_TYPE_SEM:
+             p_sem = (OS_SEM *)((void *)p_obj);
+             if (p_sem->Ctr == (OS_SEM_CTR)0) {
+                 return (DEF_FALSE);
+             }
+             p_sem->Ctr--;
+            *p_msg      = (void      *)0;
+            *p_msg_size = (OS_MSG_SIZE)0;
+            *p_ts       = p_sem->TS;
+             return (DEF_TRUE);
+#endif
+
+#if OS_CFG_Q_EN > 0u
+        case OS_OBJ_TYPE_Q:
+             p_q    = (OS_Q *)((void *)p_obj);
+            *p_msg  = OS_MsgQGet(&p_q->MsgQ,
+                                 p_msg_size,
+                                 p_ts,
+                                 &err);
+             return ((err == OS_ERR_NONE) ? DEF_TRUE : DEF_FALSE);
+#endif
+
+        default:
+             return (DEF_FALSE);
+    }
+}
+
+
+CPU_BOOLEAN  OS_WaitSetObjRdy (OS_PEND_OBJ  *p_obj)
+{
+    switch (p_obj->Type) {
+#if OS_CFG_SEM_EN > 0u
+        case OS_OBJ_TYPE_SEM:
+             return ((((OS_SEM *)((void *)p_obj))->Ctr > (OS_SEM_CTR)0) ? DEF_TRUE : DEF_FALSE);
+#endif
+
+#if OS_CFG_Q_EN > 0u
+        case OS_OBJ_TYPE_Q:
+             return ((((OS_Q *)((void *)p_obj))->MsgQ.NbrEntries > (OS_MSG_QTY)0) ? DEF_TRUE : DEF_FALSE);
+#endif
+
+        default:
+             return (DEF_FALSE);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           APPEND AN ENTRY TO THE READY LIST
+*
+* Description: This function appends an entry to the tail of its set's ready list.
+*
+* Arguments  : p_entry       is a pointer to the entry
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_WaitSetRdyAppend (OS_WAIT_SET_ENTRY  *p_entry)
+{
+    OS_WAIT_SET  *p_set;
+
+
+
+    p_set               =  p_entry->SetPtr;
+    p_entry->RdyNextPtr = (OS_WAIT_SET_ENTRY *)0;
+    p_entry->RdyFlag    =  DEF_TRUE;
+    if (p_set->RdyTailPtr == (OS_WAIT_SET_ENTRY *)0) {
+        p_set->RdyHeadPtr = p_entry;
+    } else {
+        p_set->RdyTailPtr->RdyNextPtr = p_entry;
+    }
+    p_set->RdyTailPtr   =  p_entry;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             SIGNAL A POST TO A WAIT SET
+*
+* Description: This function is called by OS_SemPost(), OS_QPost(), OSSemSet() and OSWaitSetAdd() after a registered
+*              object received a count or a message that no task was pending for.  Tasks pending on the set are handed
+*              the object directly; if the object is still ready afterwards it is queued in the set's ready list.
+*
+* Arguments  : p_entry       is a pointer to the entry of the posted object
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function assumes that it is called with the scheduler locked or interrupts disabled.  The
+*                 caller must run the scheduler afterwards.
+************************************************************************************************************************
+*/
+
+void  OS_WaitSetSignal (OS_WAIT_SET_ENTRY  *p_entry)
+{
+    OS_WAIT_SET   *p_set;
+    OS_PEND_DATA  *p_pend_data;
+    void          *p_void;
+    OS_MSG_SIZE    msg_size;
+    CPU_TS         ts;
+
+
+
+    p_set = p_entry->SetPtr;
+    while (p_set->PendList.NbrEntries > (OS_OBJ_QTY)0) {    /* Hand the object to the tasks waiting on the set        */
+        if (OS_WaitSetObjGet(p_entry->ObjPtr, &p_void, &msg_size, &ts) == DEF_FALSE) {
+            return;
+        }
+        p_pend_data             = p_set->PendList.HeadPtr;
+        p_pend_data->RdyObjPtr  = p_entry->ObjPtr;
+        p_pend_data->RdyMsgPtr  = p_void;
+        p_pend_data->RdyMsgSize = msg_size;
+        p_pend_data->RdyTS      = ts;
+        OS_Post((OS_PEND_OBJ *)((void *)p_set),
+                p_pend_data->TCBPtr,
+                p_void,
+                msg_size,
+                ts);
+    }
+
+    if ((p_entry->RdyFlag == DEF_FALSE) &&                  /* Queue the object if it is still ready                  */
+        (OS_WaitSetObjRdy(p_entry->ObjPtr) == DEF_TRUE)) {
+        OS_WaitSetRdyAppend(p_entry);
+    }
+}
+#endif
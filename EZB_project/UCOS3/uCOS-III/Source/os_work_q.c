@@ -0,0 +1,616 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2014; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                WORK QUEUE MANAGEMENT
+*
+* File    : OS_WORK_Q.C
+* Version : V3.04.03
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) A work queue distributes items to a set of identical worker tasks.  Each worker owns a local queue of
+*               OS_MSGs & a semaphore it sleeps on, so OSWorkQPost() picks the worker that gets an item and wakes
+*               exactly that one, instead of letting the pend list hand everything to the highest priority worker.
+*
+*           (2) An item goes to the first idle worker after the one served last.  When no worker is idle, it goes to
+*               the next worker in turn (OS_OPT_WORK_Q_RR) or to the worker with the fewest queued items
+*               (OS_OPT_WORK_Q_LEAST_LOADED).
+*
+*           (3) A worker whose local queue is empty steals the oldest item of the worker with the most queued items
+*               before going to sleep, so items queued behind a long job are not stuck there.
+*
+*           (4) .ItemCtr & .StealCtr of each worker count the items it processed & stole.  Sampling .ItemCtr at a
+*               fixed interval gives the throughput of the worker.
+************************************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_work_q__c = "$Id: $";
+#endif
+
+
+#if OS_CFG_WORK_Q_EN > 0u
+/*
+************************************************************************************************************************
+*                                                 CREATE A WORK QUEUE
+*
+* Description: This function creates a work queue without workers.  Workers are added with OSWorkQWorkerAdd().
+*
+* Arguments  : p_wq          is a pointer to the work queue to create.
+*
+*              p_name        is a pointer to an ASCII string used to name the work queue.
+*
+*              opt           selects the worker that gets an item when no worker is idle (see Note #2 at the top of
+*                            this file):
+*
+*                                OS_OPT_WORK_Q_RR              the next worker in turn
+*                                OS_OPT_WORK_Q_LEAST_LOADED    the worker with the fewest queued items
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_CREATE_ISR                 if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to create the work queue after
+*                                                                  you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_wq' is a NULL pointer
+*                                OS_ERR_OPT_INVALID                if 'opt' is not valid
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSWorkQCreate (OS_WORK_Q  *p_wq,
+                     CPU_CHAR   *p_name,
+                     OS_OPT      opt,
+                     OS_ERR     *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_wq == (OS_WORK_Q *)0) {                           /* Validate arguments                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_WORK_Q_RR:
+        case OS_OPT_WORK_Q_LEAST_LOADED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_OBJ_TYPE_REQ > 0u
+    p_wq->Type          = OS_OBJ_TYPE_WORK_Q;               /* Mark the data structure as a work queue                */
+#endif
+#if OS_CFG_DBG_EN > 0u
+    p_wq->NamePtr       = p_name;
+#else
+    (void)&p_name;
+#endif
+    p_wq->WorkerListPtr = (OS_WORK_Q_WORKER *)0;
+    p_wq->WorkerNextPtr = (OS_WORK_Q_WORKER *)0;
+    p_wq->NbrWorkers    = (OS_OBJ_QTY)0;
+    p_wq->Opt           = opt;
+    p_wq->PostCtr       = (OS_CTR    )0;
+   *p_err               = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ADD A WORKER TO A WORK QUEUE
+*
+* Description: This function adds a worker to a work queue.  The worker task then calls OSWorkQPend() with 'p_worker'
+*              to get its items.
+*
+* Arguments  : p_wq          is a pointer to the work queue.
+*
+*              p_worker      is a pointer to the worker to add.
+*
+*              p_name        is a pointer to an ASCII string used to name the worker (and its semaphore).
+*
+*              max_qty       is the maximum number of items queued locally for this worker.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       if the call was successful
+*                                OS_ERR_CREATE_ISR                 if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME    if you are trying to add the worker after you called
+*                                                                  OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL               if 'p_wq' or 'p_worker' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                   if 'p_wq' is not a work queue
+*                                OS_ERR_Q_SIZE                     if 'max_qty' is 0
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSWorkQWorkerAdd (OS_WORK_Q         *p_wq,
+                        OS_WORK_Q_WORKER  *p_worker,
+                        CPU_CHAR          *p_name,
+                        OS_MSG_QTY         max_qty,
+                        OS_ERR            *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to be called from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_wq     == (OS_WORK_Q        *)0) ||              /* Validate arguments                                     */
+        (p_worker == (OS_WORK_Q_WORKER *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (max_qty == (OS_MSG_QTY)0) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_wq->Type != OS_OBJ_TYPE_WORK_Q) {                 /* Make sure work queue was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OSSemCreate(&p_worker->Sem,                             /* Semaphore the worker sleeps on when idle               */
+                 p_name,
+                 0u,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+#if OS_CFG_DBG_EN > 0u
+    p_worker->NamePtr  = p_name;
+#endif
+    p_worker->WorkQPtr = p_wq;
+    p_worker->Idle     = DEF_FALSE;
+    p_worker->ItemCtr  = (OS_CTR)0;
+    p_worker->StealCtr = (OS_CTR)0;
+    OS_MsgQInit(&p_worker->MsgQ,
+                max_qty);
+
+    CPU_CRITICAL_ENTER();
+    p_worker->NextPtr   = p_wq->WorkerListPtr;              /* Link the worker to the work queue                      */
+    p_wq->WorkerListPtr = p_worker;
+    if (p_wq->WorkerNextPtr == (OS_WORK_Q_WORKER *)0) {
+        p_wq->WorkerNextPtr = p_worker;
+    }
+    p_wq->NbrWorkers++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 WAIT FOR A WORK ITEM
+*
+* Description: This function is called by a worker task to get its next item.  The item comes from the local queue of
+*              the worker or, if it is empty, is stolen from the busiest other worker (see Note #3 at the top of this
+*              file).  If there is no item, the worker waits to be given one.
+*
+* Arguments  : p_worker      is a pointer to the worker added to the work queue with OSWorkQWorkerAdd().
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for an
+*                            item up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until an item arrives.
+*
+*              opt           determines whether the user wants to block if no item is available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the item.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received an item
+*                                OS_ERR_OBJ_DEL            If the semaphore of the worker was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_worker' or 'p_msg_size' is a NULL pointer
+*                                OS_ERR_PEND_ABORT         If the pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no item was available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_TIMEOUT            An item was not received within the specified timeout
+*
+* Returns    : != (void *)0  is a pointer to the item received
+*              == (void *)0  if an error occurred
+*
+* Note(s)    : 1) A worker may be woken for an item that another worker stole in the meantime.  It then waits again,
+*                 for what is left of 'timeout' counted from the call, so the whole call never waits longer.
+************************************************************************************************************************
+*/
+
+void  *OSWorkQPend (OS_WORK_Q_WORKER  *p_worker,
+                    OS_TICK            timeout,
+                    OS_OPT             opt,
+                    OS_MSG_SIZE       *p_msg_size,
+                    OS_ERR            *p_err)
+{
+    OS_WORK_Q_WORKER  *p_victim;
+    void              *p_void;
+    OS_TICK            tick_start;
+    OS_TICK            tick_elapsed;
+    OS_TICK            tick_rem;
+    OS_ERR             err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* Not allowed to call from an ISR                        */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((void *)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if ((p_worker   == (OS_WORK_Q_WORKER *)0) ||            /* Validate arguments                                     */
+        (p_msg_size == (OS_MSG_SIZE      *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    tick_start = OSTickCtr;                                 /* The timeout runs from here (see Note #1)               */
+    CPU_CRITICAL_EXIT();
+    tick_rem   = timeout;
+
+    for (;;) {
+        CPU_CRITICAL_ENTER();
+        p_void = OS_MsgQGet(&p_worker->MsgQ,                /* Any item queued for this worker?                       */
+                             p_msg_size,
+                            (CPU_TS *)0,
+                            &err);
+        if (err != OS_ERR_NONE) {                           /* No, steal one from the busiest worker                  */
+            p_victim = OS_WorkQWorkerMostLoaded(p_worker->WorkQPtr);
+            if (p_victim != (OS_WORK_Q_WORKER *)0) {
+                p_void = OS_MsgQGet(&p_victim->MsgQ,
+                                     p_msg_size,
+                                    (CPU_TS *)0,
+                                    &err);
+                p_worker->StealCtr++;
+            }
+        }
+        if (err == OS_ERR_NONE) {
+            p_worker->Idle = DEF_FALSE;
+            p_worker->ItemCtr++;
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_NONE;
+            return (p_void);
+        }
+
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != (OS_OPT)0) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;
+            return ((void *)0);
+        }
+        if (timeout != (OS_TICK)0) {                        /* Wait only for what is left of the timeout              */
+            tick_elapsed = OSTickCtr - tick_start;
+            if (tick_elapsed >= timeout) {
+                CPU_CRITICAL_EXIT();
+               *p_msg_size = (OS_MSG_SIZE)0;
+               *p_err      =  OS_ERR_TIMEOUT;
+                return ((void *)0);
+            }
+            tick_rem = timeout - tick_elapsed;
+        }
+        p_worker->Idle = DEF_TRUE;                          /* Let OSWorkQPost() wake this worker                     */
+        CPU_CRITICAL_EXIT();
+
+        (void)OSSemPend(&p_worker->Sem,
+                         tick_rem,
+                         OS_OPT_PEND_BLOCKING,
+                        (CPU_TS *)0,
+                         p_err);
+        if (*p_err != OS_ERR_NONE) {                        /* Timeout, abort, ...                                    */
+            CPU_CRITICAL_ENTER();
+            p_worker->Idle = DEF_FALSE;
+            CPU_CRITICAL_EXIT();
+           *p_msg_size = (OS_MSG_SIZE)0;
+            return ((void *)0);
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               POST AN ITEM TO A WORK QUEUE
+*
+* Description: This function gives an item to one worker of a work queue and wakes that worker if it is idle (see
+*              Note #2 at the top of this file).
+*
+* Arguments  : p_wq          is a pointer to the work queue.
+*
+*              p_void        is a pointer to the item.
+*
+*              msg_size      specifies the size of the item (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option selected
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the item was queued
+*                                OS_ERR_MSG_POOL_EMPTY     If there are no more OS_MSGs to hold the item
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_wq' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_wq' is not a work queue
+*                                OS_ERR_OPT_INVALID        If 'opt' is not valid
+*                                OS_ERR_POST_ISR           If you called this function from an ISR while
+*                                                          OS_CFG_ISR_POST_DEFERRED_EN is enabled
+*                                OS_ERR_Q_MAX              If the queue of the selected worker is full
+*                                OS_ERR_WORK_Q_NO_WORKER   If the work queue has no worker
+*
+* Returns    : None
+************************************************************************************************************************
+*/
+
+void  OSWorkQPost (OS_WORK_Q    *p_wq,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    OS_WORK_Q_WORKER  *p_worker;
+    CPU_BOOLEAN        wake;
+    CPU_TS             ts;
+    OS_ERR             err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* The OS_MSG pool is only locked against tasks           */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_wq == (OS_WORK_Q *)0) {                           /* Validate arguments                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_wq->Type != OS_OBJ_TYPE_WORK_Q) {                 /* Make sure work queue was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    ts = OS_TS_GET();                                       /* Get timestamp                                          */
+
+    CPU_CRITICAL_ENTER();
+    p_worker = OS_WorkQWorkerSel(p_wq);
+    if (p_worker == (OS_WORK_Q_WORKER *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WORK_Q_NO_WORKER;
+        return;
+    }
+    OS_MsgQPut(&p_worker->MsgQ,                             /* Queue the item for the selected worker                 */
+                p_void,
+                msg_size,
+                OS_OPT_POST_FIFO,
+                ts,
+                p_err);
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    p_wq->PostCtr++;
+    wake           = p_worker->Idle;                        /* Wake the worker only once until it runs again          */
+    p_worker->Idle = DEF_FALSE;
+    CPU_CRITICAL_EXIT();
+
+    if (wake == DEF_TRUE) {
+        (void)OSSemPost(&p_worker->Sem,
+                         OS_OPT_POST_1 | opt,
+                        &err);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               SELECT THE WORKER OF AN ITEM
+*
+* Description: This function selects the worker that gets the next item posted to a work queue (see Note #2 at the top
+*              of this file) and moves the round-robin position past it.
+*
+* Arguments  : p_wq          is a pointer to the work queue.
+*
+* Returns    : a pointer to the worker, or NULL if the work queue has no worker.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+OS_WORK_Q_WORKER  *OS_WorkQWorkerSel (OS_WORK_Q  *p_wq)
+{
+    OS_WORK_Q_WORKER  *p_start;
+    OS_WORK_Q_WORKER  *p_worker;
+    OS_WORK_Q_WORKER  *p_sel;
+
+
+    p_start = p_wq->WorkerNextPtr;
+    if (p_start == (OS_WORK_Q_WORKER *)0) {                 /* No worker yet                                          */
+        return ((OS_WORK_Q_WORKER *)0);
+    }
+
+    p_sel    = (OS_WORK_Q_WORKER *)0;
+    p_worker = p_start;
+    do {                                                    /* First idle worker in turn                              */
+        if (p_worker->Idle == DEF_TRUE) {
+            p_sel = p_worker;
+        } else {
+            p_worker = p_worker->NextPtr;
+            if (p_worker == (OS_WORK_Q_WORKER *)0) {
+                p_worker = p_wq->WorkerListPtr;
+            }
+        }
+    } while ((p_sel    == (OS_WORK_Q_WORKER *)0) &&
+             (p_worker != p_start));
+
+    if (p_sel == (OS_WORK_Q_WORKER *)0) {                   /* All workers busy                                       */
+        if ((p_wq->Opt                  == OS_OPT_WORK_Q_RR) &&
+            (p_start->MsgQ.NbrEntries    < p_start->MsgQ.NbrEntriesSize)) {
+            p_sel = p_start;
+        } else {                                            /* Least loaded, or next in turn is full                  */
+            p_sel    = p_wq->WorkerListPtr;
+            p_worker = p_sel->NextPtr;
+            while (p_worker != (OS_WORK_Q_WORKER *)0) {
+                if (p_worker->MsgQ.NbrEntries < p_sel->MsgQ.NbrEntries) {
+                    p_sel = p_worker;
+                }
+                p_worker = p_worker->NextPtr;
+            }
+        }
+    }
+
+    p_wq->WorkerNextPtr = p_sel->NextPtr;                   /* Next turn starts after the selected worker             */
+    if (p_wq->WorkerNextPtr == (OS_WORK_Q_WORKER *)0) {
+        p_wq->WorkerNextPtr = p_wq->WorkerListPtr;
+    }
+    return (p_sel);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            FIND THE BUSIEST WORKER OF A WORK QUEUE
+*
+* Description: This function returns the worker with the most queued items, to steal from.
+*
+* Arguments  : p_wq          is a pointer to the work queue.
+*
+* Returns    : a pointer to the worker, or NULL if no worker has a queued item.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+OS_WORK_Q_WORKER  *OS_WorkQWorkerMostLoaded (OS_WORK_Q  *p_wq)
+{
+    OS_WORK_Q_WORKER  *p_worker;
+    OS_WORK_Q_WORKER  *p_sel;
+    OS_MSG_QTY         nbr_max;
+
+
+    p_sel    = (OS_WORK_Q_WORKER *)0;
+    nbr_max  = (OS_MSG_QTY)0;
+    p_worker = p_wq->WorkerListPtr;
+    while (p_worker != (OS_WORK_Q_WORKER *)0) {
+        if (p_worker->MsgQ.NbrEntries > nbr_max) {
+            nbr_max = p_worker->MsgQ.NbrEntries;
+            p_sel   = p_worker;
+        }
+        p_worker = p_worker->NextPtr;
+    }
+    return (p_sel);
+}
+#endif